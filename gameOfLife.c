@@ -1,24 +1,119 @@
 /* Program gameOfLife.c */
 /* This is a litte implementation of John Conway's Game of Life cellular automaton.
  *
- * A Game - a pair of 2-dimensional char arrays is created by createGame.
- * Each 2-dimensional char array is a Grid. Grid size is limited by LLONG_MAX in the x-component and by LLONG_MAX * CHAR_BIT in the y-component.
- * Each bit represents a single cellof the automaton.
+ * A Game - a pair of 2-dimensional bit arrays is created by createGame.
+ * Each 2-dimensional bit array is a Grid. Grid size is limited by LLONG_MAX in the x-component and in the y-component.
+ * By default all rows of a Grid live in a single 64-byte-aligned block (GOL__STORAGE__CONTIGUOUS) with a padded row stride;
+ * GOL__STORAGE__ROWS allocates every row on its own. Either way, origin[i] points at row i and every row has a ghost cell on
+ * each side, and there is a ghost row above and below the Grid.
+ * Each bit represents a single cell of the automaton: a row packs 64 cells into every uint64_t word, column y in bit y % 64 of word y / 64,
+ * which is the layout the bitboard engines compute on, so they step the rows in place.
  * A torus "wrap-around" topology is optional (GOL__OOBR__TORUS).
  * 
  * iterateGame updates the state according to Game of Life's rules.
+ * Other life-like rules are set per Game in B/S notation with setGameRule, e.g. "B36/S23" (HighLife). Conway's rule, HighLife,
+ * Day & Night and Seeds have bitboard kernels of their own; every other rule runs on a generic kernel driven by the Rule's masks.
+ * HashLife and the Plane always use Conway's rule; importing a Game with any other rule into them is an error.
  * It reads from one Grid and writes into the other, then switches. That way, no new memory needs to be allocated.
+ * The stepping engine is selectable per Game with setGameEngine:
+ * GOL__ENGINE__REFERENCE visits every cell with getCell; GOL__ENGINE__SCALAR reads the neighbors straight from the rows;
+ * GOL__ENGINE__BITBOARD steps the packed rows in place and updates 64 cells at a time with bitwise full adders.
+ * The bitboard row kernel is picked at startup from what the CPU supports (AVX-512, AVX2, or portable C); see selectRowKernel.
+ * GOL__ENGINE__LOOKUP steps 2 by 2 blocks of cells with one lookup each in a 64K-entry table of all 4 by 4 neighborhoods; it needs no SIMD.
+ * GOL__ENGINE__TILED splits the Grid into 64 by 64 tiles and only recomputes tiles next to a tile that changed in the last generation.
+ * GOL__ENGINE__PARALLEL runs the bitboard engine on bands of rows, one per thread of a persistent pool (setGameThreadCount).
+ * iterateGameN advances several generations at once; with the bitboard and parallel engines it keeps a band of rows in the cache
+ * for up to GOL__TEMPORAL__GENERATIONS generations (temporal blocking), instead of streaming both Grids through memory every time.
+ * Before each generation, fillGridHalo writes the out-of-bounds cells into the ghost rows and columns,
+ * so no engine but the reference one has to check bounds.
  *
- * printAndIterateGameLoop showcases the evolution a single game in an endless loop in the standard output.
+ * For long runs of structured patterns there is a separate HashLife universe: a hash-consed quadtree whose nodes memoize
+ * their future, so that advanceHashLife skips 2^k generations at once. It models an infinite plane of dead cells and
+ * imports from and exports to a Game, where it agrees with GOL__OOBR__ALL_OFF as long as the pattern stays inside the Grid.
+ *
+ * The Plane is an unbounded alternative to a Game: live 64 by 64 chunks in an open-addressing hash map keyed by chunk coordinates.
+ * Chunks are allocated where the pattern spreads and freed where it dies, so memory follows the live region, not a bounding box.
+ *
+ * Every generation of the bitboard engines also yields GenerationStats - population, changed cells and the bounding box of the live cells -
+ * counted with popcount on the packed rows in passing; getGameStats returns them, and measures the Grid after the other engines.
+ * The stats carry a hash of the Grid, which a CycleDetector keeps for the last generations to spot still lifes and oscillators early;
+ * it keeps those generations in packed rows as well, so that a hash match is confirmed against the very Grid it matched.
+ *
+ * randomizeGameWithSeed fills a Grid with a soup of any density from a counter-based generator, 64 cells per random word, spread over the
+ * thread pool; a seed gives the same soup for every thread count.
+ *
+ * Run with --benchmark [generations] [--csv | --json] to time every engine and row kernel on a fixed set of workloads
+ * (random soups of several densities, a glider gun, an R-pentomino and a large torus) without printing the Grids.
+ * Run with --verify [generations] [--seed n] to check every engine, row kernel and storage mode - file-backed and snapshot-mapped Games
+ * included - and the GameBatch cell by cell against the reference engine, on tiny and word-straddling Grids with every outOfBoundsRule;
+ * HashLife and the Plane follow the all-off Conway cases for as long as the population keeps off the edge of the Grid. Compiled with
+ * -DGOL__FUZZ, the program instead provides LLVMFuzzerTestOneInput, which does the same for Grid sizes, rules and seeds chosen by libFuzzer;
+ * with -DGOL__FUZZ_RLE as well, it feeds the input to the RLE reader instead.
+ *
+ * A GameBatch runs 64 small Games of equal size side by side, bit-sliced: every cell is a uint64_t whose bit L belongs to lane L,
+ * so one pass of bitwise adders advances all 64. Per-lane masks tell which lanes died out or settled, e.g. for soup census work.
+ *
+ * printAndIterateGameLoop showcases the evolution a single game in an endless loop in the standard output. It draws through a Renderer,
+ * which builds each frame in one buffer, sends it with a single write and ANSI cursor movement, and redraws only the rows that changed.
+ * Patterns load from and save to the Life RLE format with readGameRle, readRlePattern and writeGameRle. The RLE width is gridSizeY,
+ * its height gridSizeX, and the rule header maps to the Game's Rule. Both directions stream and work on packed rows.
+ *
+ * Checkpoints are binary snapshots: a versioned header and the rows laid out exactly as in contiguous storage, starting on a page,
+ * so loadGameSnapshot maps the file privately and uses it as a Grid without parsing. startGameSnapshot saves on a background thread
+ * while the Game steps into its other Grid.
+ *
+ * Grids larger than memory live in a file: createGameInFile maps a sparse file shared, and the bitboard engines walk its rows in bands,
+ * reading the next band ahead and dropping finished ones with madvise, so that each generation streams through the file once.
+ *
+ * Compiled with -DGOL__PERF_COUNTERS on Linux, enableGamePerfCounters opens hardware counters with perf_event_open that iterateGame and
+ * iterateGameN read around every engine pass: cycles, instructions, last-level cache references and misses, branch misses and page faults,
+ * logged per pass and summed per run. Without the flag the hooks compile to nothing.
+ *
+ * runAndRenderGameLoop steps the Game flat out on a thread of its own while the calling thread draws the latest generation at a fixed
+ * frame rate; the two hand over copies of the Grid through a lock-free triple buffer, and a copy is made only when a frame is due.
+ * Grids larger than the terminal are drawn through a Viewport: a window that can pan and zoom, where each glyph sums blocks of cells
+ * with popcount on packed rows into a density character, Unicode half blocks or braille dots.
  *
  * This program works on Windows and Linux.
- * Compile in linux with: gcc -o gameOfLife gameOfLife.c -std=gnu11
+ * Compile in linux with: gcc -o gameOfLife gameOfLife.c -std=gnu11 -pthread
  */
 
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+
+#ifndef _WINDOWS
+#define GOL__THREADS // persistent worker threads for GOL__ENGINE__PARALLEL; without them the engine runs on the calling thread
+#include <pthread.h>
+#include <stdatomic.h>
+#endif
+
+#ifdef GOL__PERF_COUNTERS // hardware counters around every engine pass; off unless compiled with -DGOL__PERF_COUNTERS
+#ifndef __linux__
+#error "GOL__PERF_COUNTERS needs Linux perf_event_open."
+#endif
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#define GOL__PERF__TASK_CLOCK 0 // nanoseconds on a CPU, summed over the calling thread and the threads it starts later
+#define GOL__PERF__CYCLES 1
+#define GOL__PERF__INSTRUCTIONS 2
+#define GOL__PERF__CACHE_REFERENCES 3 // last-level cache
+#define GOL__PERF__CACHE_MISSES 4 // last-level cache; each one moves a line of GOL__PERF__LINE_BYTES to or from memory
+#define GOL__PERF__BRANCH_MISSES 5
+#define GOL__PERF__PAGE_FAULTS 6
+#define GOL__PERF__EVENTS 7
+#define GOL__PERF__LINE_BYTES 64 // for the memory bandwidth estimated from last-level cache misses
+#define GOL__PERF__UNAVAILABLE ULLONG_MAX // the value of an event the kernel or the hardware does not offer
+#define GOL__PERF_BEGIN( gamePtr ) if ( (gamePtr)->perfCountersPtr != NULL ) { beginPerfSample( (gamePtr)->perfCountersPtr ); }
+#define GOL__PERF_END( gamePtr, generations ) if ( (gamePtr)->perfCountersPtr != NULL ) { endPerfSample( (gamePtr)->perfCountersPtr, (generations), (gamePtr)->generation ); }
+#else
+#define GOL__PERF_BEGIN( gamePtr )
+#define GOL__PERF_END( gamePtr, generations )
+#endif
 
 #define GOL__CELL_STATE__OFF 0
 #define GOL__CELL_STATE__ON 1
@@ -28,6 +123,95 @@
 #define GOL__OOBR__ALL_ON 1
 #define GOL__OOBR__TORUS 2
 
+#define GOL__ENGINE__SCALAR 0
+#define GOL__ENGINE__BITBOARD 1
+#define GOL__ENGINE__REFERENCE 2
+#define GOL__ENGINE__PARALLEL 3
+#define GOL__ENGINE__TILED 4
+#define GOL__ENGINE__LOOKUP 5
+
+#define GOL__TEMPORAL__GENERATIONS 8 // generations per pass of iterateGameN; each band reads this many extra rows on each side
+#define GOL__TEMPORAL__CACHE_BYTES ( 256 * 1024 ) // target size of the two packed band buffers of one thread
+#define GOL__TEMPORAL__MIN_ROWS 32 // smallest band, so that the extra rows stay a minor part of the work
+
+#define GOL__STATS__STALE ULLONG_MAX // GenerationStats.generation of stats that no longer describe the current Grid
+
+#define GOL__RANDOM__DENSITY_BITS 24 // randomizeGridWithSeed rounds the density to a multiple of 1 / 2^GOL__RANDOM__DENSITY_BITS
+#define GOL__RANDOM__CHUNK_WORDS 64 // random words generated at a time before they are unpacked into the row
+#define GOL__RANDOM__PARALLEL_CELLS ( 1LL << 20 ) // randomizeGameWithSeed uses the thread pool from this many cells on
+
+#define GOL__RULE__CONWAY 0 // B3/S23
+#define GOL__RULE__HIGHLIFE 1 // B36/S23
+#define GOL__RULE__DAY_AND_NIGHT 2 // B3678/S34678
+#define GOL__RULE__SEEDS 3 // B2/S
+#define GOL__RULE__GENERIC 4 // any other rule
+#define GOL__RULE__NOTATION_SIZE 22 // "B012345678/S012345678" and the terminating null
+
+#define GOL__TILE__ROWS 64 // a tile is GOL__TILE__ROWS rows by one word
+
+#define GOL__LOOKUP__ENTRIES ( 1 << 16 ) // one per 4 by 4 block of cells
+
+#define GOL__BITBOARD__CELLS_PER_WORD 64
+
+#define GOL__HASHLIFE__MAX_LEVEL 60 // coordinates stay within long long
+#define GOL__HASHLIFE__NODE_LIMIT 4000000 // default for nodeLimit; about 300 MB of nodes
+
+#define GOL__CHUNK__SIZE 64 // a Plane chunk is 64 rows of one word
+#define GOL__PLANE__MIN_SLOTS 64
+
+#define GOL__RENDER__TITLE_SIZE 120 // longest title line; longer titles are cut
+#define GOL__RENDER__FRAME_OVERHEAD ( GOL__RENDER__TITLE_SIZE + 32 ) // the title line and its escape sequences
+#define GOL__RENDER__ROW_OVERHEAD 32 // a cursor position escape sequence and the line end
+#define GOL__EXCHANGE__FRESH 4 // flag in FrameExchange.middle: the middle copy holds a frame the renderer has not taken yet
+#define GOL__GLYPHS__DENSITY 0 // one dot per glyph, drawn as one of GOL__GLYPHS__RAMP by its share of live cells
+#define GOL__GLYPHS__HALF_BLOCK 1 // two dots per glyph, one above the other, drawn with Unicode half blocks
+#define GOL__GLYPHS__BRAILLE 2 // eight dots per glyph, four rows by two columns, drawn with Unicode braille patterns
+#define GOL__GLYPHS__RAMP " .:-=+*#%@"
+#define GOL__GLYPHS__UTF8_SIZE 3 // the longest glyph in bytes
+#define GOL__RLE__BUFFER_SIZE 65536 // bytes read from an RLE stream at a time
+#define GOL__RLE__HEADER_SIZE 256 // longest header line
+#define GOL__RLE__LINE_LENGTH 70 // longest line written
+#define GOL__SNAPSHOT__MAGIC "GOLSNAP" // with its terminating 0, the first 8 bytes of a snapshot file
+#define GOL__SNAPSHOT__VERSION 2 // 1 stored a char per cell
+#define GOL__SNAPSHOT__ALIGNMENT 4096 // the payload starts on a page boundary, so that it can be mapped in place
+
+#define GOL__FILE__BAND_BYTES ( 64 * 1024 * 1024 ) // rows of a file-backed Grid are read ahead and dropped in bands of about this size
+#define GOL__BENCHMARK__TEXT 0
+#define GOL__BENCHMARK__CSV 1
+#define GOL__BENCHMARK__JSON 2
+#define GOL__BENCHMARK__GENERATIONS 200 // default for --benchmark
+#define GOL__BENCHMARK__REFERENCE_SHARE 16 // the reference engine runs only generations / GOL__BENCHMARK__REFERENCE_SHARE
+#define GOL__BENCHMARK__SOUP_SIZE 32 // the 64 soups of the batch comparison are GOL__BENCHMARK__SOUP_SIZE cells square
+
+#define GOL__PATTERN__SOUP 0
+#define GOL__PATTERN__GLIDER_GUN 1
+#define GOL__PATTERN__R_PENTOMINO 2
+#define GOL__PATTERN__FULL 3 // every cell on
+#define GOL__PATTERN__BORDER 4 // the cells on the edges of the Grid
+#define GOL__PATTERN__CHECKERBOARD 5
+#define GOL__PATTERN__CORNER_GLIDERS 6 // a glider in each corner, heading out of the Grid
+
+#define GOL__VERIFY__GENERATIONS 64 // default for --verify
+#define GOL__VERIFY__SEED 1 // default for --verify
+#define GOL__VERIFY__THREADS 3 // for the parallel variants, so that even small Grids are split into several bands
+#define GOL__VERIFY__PATH_SIZE 512 // longest path of a scratch file for the file-backed and mapped variants
+#define GOL__FUZZ__RLE_SIZE_X 100 // the Grid RLE fuzz inputs are read into; patterns up to this many rows
+#define GOL__FUZZ__RLE_SIZE_Y 130 // and columns, so that rows straddle a word boundary
+
+#define GOL__KERNEL__AUTO 0
+#define GOL__KERNEL__PORTABLE 1
+#define GOL__KERNEL__AVX2 2
+#define GOL__KERNEL__AVX512 3
+
+#define GOL__STORAGE__ROWS 0
+#define GOL__STORAGE__CONTIGUOUS 1
+#define GOL__STORAGE__MAPPED 2 // rows in a private mapping of a snapshot file (loadGameSnapshot); only the row pointers are allocated
+#define GOL__STORAGE__FILE 3 // rows in a shared mapping of a sparse file (createGameInFile), paged in and out by band as the engine walks them
+
+#define GOL__GRID__ALIGNMENT 64 // bytes; rows of contiguous storage start on a cache line
+#define GOL__GRID__ROW_OFFSET 8 // bytes in front of column 0 of each row: one word, whose bit 63 is the ghost cell in column -1
+#define GOL__GRID__ALIASING_STRIDE 4096 // row strides that are a multiple of this are padded by one GOL__GRID__ALIGNMENT
+
 
 
 typedef char ErrorChar;
@@ -35,35 +219,317 @@ typedef char ErrorChar;
 typedef char CellState;
 
 typedef struct Grid_ {
-	char **origin;
+	uint64_t **origin; // origin[-1] .. origin[arraySizeX]; the first and the last are ghost rows. Each row is packed as for the bitboard engines
 	long long gridSizeX;
 	long long gridSizeY;
 	size_t arraySizeX;
-	size_t arraySizeY;
+	size_t arraySizeY; // words per row from column 0 up to the ghost cell in column gridSizeY, which follows the last cell
+	size_t rowStride; // bytes reserved per row, including the ghost cells and the padding
+	void *storage; // the block holding all rows with GOL__STORAGE__CONTIGUOUS, the mapping with GOL__STORAGE__MAPPED or GOL__STORAGE__FILE; NULL with GOL__STORAGE__ROWS
+	size_t storageSize; // bytes mapped with GOL__STORAGE__MAPPED or GOL__STORAGE__FILE
+	char storageMode; // GOL__STORAGE__ROWS, GOL__STORAGE__CONTIGUOUS, GOL__STORAGE__MAPPED or GOL__STORAGE__FILE
 	char outOfBoundsRule; //  GOL__OOBR__ALL_OFF, GOL__OOBR__ALL_ON, or GOL__OOBR__TORUS
 } Grid;
 
+typedef struct ThreadPool_ ThreadPool;
+
+typedef void (*ThreadJob)( void *argument, int threadIndex, int threadCount );
+
+#ifdef GOL__THREADS
+typedef struct ThreadPoolWorker_ {
+	ThreadPool *poolPtr;
+	int threadIndex;
+	pthread_t thread;
+} ThreadPoolWorker;
+#endif
+
+struct ThreadPool_ {
+	int threadCount; // including the thread that calls runThreadPool
+#ifdef GOL__THREADS
+	ThreadPoolWorker *workers; // threadCount - 1 threads, parked at startBarrier between jobs
+	pthread_mutex_t startupLock; // held while the workers are created, so that the barriers can still be resized if one fails to start
+	pthread_barrier_t startBarrier;
+	pthread_barrier_t doneBarrier;
+#endif
+	ThreadJob job;
+	void *jobArgument;
+	bool stopping;
+};
+
+typedef struct HashLifeNode_ {
+	struct HashLifeNode_ *nw; // quadrants; NULL for the two level 0 nodes, which are single cells
+	struct HashLifeNode_ *ne;
+	struct HashLifeNode_ *sw;
+	struct HashLifeNode_ *se;
+	struct HashLifeNode_ *next; // next node in the same hash bucket, or in the free list
+	struct HashLifeNode_ *result; // the centre, one level down, 2^resultLog generations later
+	unsigned long long population;
+	char level; // the node covers 2^level by 2^level cells
+	char resultLog; // -1 while result is not computed
+	bool marked; // used by collectHashLifeGarbage
+} HashLifeNode;
+
+typedef struct HashLifeNodeBlock_ {
+	struct HashLifeNodeBlock_ *next;
+	HashLifeNode nodes[4096];
+} HashLifeNodeBlock;
+
+typedef struct HashLife_ {
+	HashLifeNode *root; // covers [ -2^( level - 1 ), 2^( level - 1 ) ) in x and in y
+	HashLifeNode deadCell;
+	HashLifeNode liveCell;
+	HashLifeNode *empty[GOL__HASHLIFE__MAX_LEVEL + 1]; // the empty node of each level, created on demand
+	HashLifeNode **buckets;
+	size_t bucketCount; // a power of two
+	size_t nodeCount;
+	size_t nodeLimit; // collectHashLifeGarbage runs before a step, once nodeCount exceeds this
+	HashLifeNode *freeNodes;
+	HashLifeNodeBlock *blocks;
+	unsigned long long generation;
+} HashLife;
+
+typedef struct TileActivity_ {
+	long long tileRows;
+	long long tileColumns;
+	unsigned char *flags; // one allocation for both flag arrays
+	unsigned char *changed; // per tile, row by row: did it change in the last generation?
+	unsigned char *nextChanged;
+	bool valid; // false until a tiled generation has run on unmodified Grids; then every tile is recomputed
+} TileActivity;
+
+typedef struct PlaneChunk_ {
+	uint64_t rows[2][GOL__CHUNK__SIZE]; // two generations; Plane.current selects the current one
+} PlaneChunk;
+
+typedef struct PlaneSlot_ {
+	long long chunkX; // the chunk holds cells ( chunkX * 64 .. chunkX * 64 + 63, chunkY * 64 .. chunkY * 64 + 63 )
+	long long chunkY;
+	PlaneChunk *chunkPtr; // NULL for a free slot
+} PlaneSlot;
+
+typedef struct Plane_ {
+	PlaneSlot *slots; // open addressing with linear probing; at most half full
+	size_t slotCount; // a power of two
+	size_t chunkCount;
+	int current; // 0 or 1
+	unsigned long long generation;
+} Plane;
+
+typedef struct BenchmarkWorkload_ {
+	const char *name;
+	long long gridSizeX;
+	long long gridSizeY;
+	char outOfBoundsRule;
+	char pattern; // GOL__PATTERN__SOUP .. GOL__PATTERN__CORNER_GLIDERS
+	double density; // share of live cells in a soup
+	const char *rule; // in B/S notation
+} BenchmarkWorkload;
+
+typedef struct VerifyVariant_ {
+	const char *name;
+	char engine;
+	char kernel; // GOL__KERNEL__AUTO keeps the kernel that was selected when the verification started
+	bool blocked; // stepped with iterateGameN instead of iterateGame
+	char storageMode;
+} VerifyVariant;
+
+typedef struct BenchmarkResult_ {
+	const char *workload;
+	const char *engine;
+	const char *kernel; // the row kernel, or "-" for engines without one
+	long long gridSizeX;
+	long long gridSizeY;
+	unsigned long long generations;
+	double seconds;
+	unsigned long long population; // after the last generation; the bounded engines of a workload agree, as do the unbounded ones
+	long peakResidentKilobytes; // of the whole process so far
+} BenchmarkResult;
+
+typedef struct Rule_ {
+	uint16_t birth; // bit n is set, if a dead cell with n live neighbors comes alive
+	uint16_t survival; // bit n is set, if a live cell with n live neighbors stays alive
+	char family; // GOL__RULE__CONWAY .. GOL__RULE__GENERIC; selects the specialized row kernel
+	uint64_t birthMasks[9]; // ~0 or 0 for each bit of birth, for the generic row kernel
+	uint64_t survivalMasks[9];
+} Rule;
+
+/* The first bytes of a snapshot file, in native byte order; a file from a machine of the other byte order fails the version check. */
+typedef struct SnapshotHeader_ {
+	char magic[8]; // GOL__SNAPSHOT__MAGIC
+	uint32_t version; // GOL__SNAPSHOT__VERSION
+	uint32_t headerSize; // sizeof( SnapshotHeader )
+	int64_t gridSizeX;
+	int64_t gridSizeY;
+	uint64_t rowStride; // bytes per row of the payload, as in the Grid
+	uint64_t payloadOffset; // a multiple of GOL__SNAPSHOT__ALIGNMENT
+	uint64_t payloadSize; // ( gridSizeX + 2 ) * rowStride: the rows of the Grid with the ghost rows, laid out as in contiguous storage
+	uint64_t generation;
+	uint64_t checksum; // of the payload, see snapshotChecksum
+	uint16_t birth; // the Rule
+	uint16_t survival;
+	uint8_t outOfBoundsRule;
+	uint8_t reserved[3];
+} SnapshotHeader;
+
+typedef struct SnapshotJob_ {
+	Grid *gridPtr; // the Grid being saved; it must not change until the job is finished
+	SnapshotHeader header;
+	FILE *stream;
+	ErrorChar error;
+#ifdef GOL__THREADS
+	pthread_t thread;
+#endif
+} SnapshotJob;
+
+typedef struct GenerationStats_ {
+	unsigned long long generation; // the generation described, or GOL__STATS__STALE
+	unsigned long long population; // live cells
+	unsigned long long changed; // cells that differ from the previous generation
+	long long minX; // the bounding box of the live cells; minX > maxX if there are none
+	long long minY;
+	long long maxX;
+	long long maxY;
+	uint64_t hash; // the sum of a hash of every live row and its index; equal Grids have equal hashes
+} GenerationStats;
+
+#ifdef GOL__PERF_COUNTERS
+typedef struct PerfSample_ {
+	unsigned long long generations; // generations covered
+	double seconds; // wall-clock time
+	unsigned long long values[GOL__PERF__EVENTS]; // GOL__PERF__TASK_CLOCK .. GOL__PERF__PAGE_FAULTS, scaled for multiplexing, or GOL__PERF__UNAVAILABLE
+} PerfSample;
+
+typedef struct PerfCounters_ {
+	int fds[GOL__PERF__EVENTS]; // -1 for an unavailable event
+	PerfSample last; // the latest engine pass
+	PerfSample total; // every pass since creation or resetPerfCounters
+	FILE *logStream; // gets a line per pass, or NULL
+	double startSeconds; // of the pass in progress
+	unsigned long long startValues[GOL__PERF__EVENTS];
+} PerfCounters;
+#endif
+
 typedef struct Game_ {
 	Grid gridA;
 	Grid gridB;
 	Grid *currentGridPtr;
+	char engine; // GOL__ENGINE__SCALAR .. GOL__ENGINE__LOOKUP
+	Rule rule; // B3/S23 unless set with setGameRule
+	int threadCount; // for GOL__ENGINE__PARALLEL; 0 means one per online CPU
+	ThreadPool *threadPoolPtr; // created on the first parallel generation
+	TileActivity *tileActivityPtr; // created on the first tiled generation
+	uint8_t *lookupTablePtr; // the block table of GOL__ENGINE__LOOKUP for the rule; built by the first lookup generation, dropped by setGameRule
+	unsigned long long generation; // generations iterated since creation, or since the snapshot the Game was loaded from
+	SnapshotJob *snapshotJobPtr; // a snapshot being saved in the background, or NULL
+	GenerationStats stats; // filled in passing by the bitboard engines, otherwise on demand by getGameStats
+#ifdef GOL__PERF_COUNTERS
+	PerfCounters *perfCountersPtr; // read around every engine pass of iterateGame and iterateGameN, or NULL
+#endif
 } Game;
 
+typedef struct GameBatch_ {
+	long long gridSizeX;
+	long long gridSizeY;
+	char outOfBoundsRule; // GOL__OOBR__ALL_OFF, GOL__OOBR__ALL_ON, or GOL__OOBR__TORUS
+	Rule rule;
+	uint64_t *cells; // three generations of ( gridSizeX + 2 ) * ( gridSizeY + 2 ) words each, the halo included
+	uint64_t *current; // bit L of the word of a cell is the cell in lane L
+	uint64_t *previous;
+	uint64_t *next;
+	uint64_t extinctLanes; // lanes without live cells
+	uint64_t stableLanes; // lanes that did not change in the last generation
+	uint64_t oscillatingLanes; // lanes that changed, but equal the generation before the last ( period 2 )
+	uint64_t editedLanes; // lanes written with setGameBatchCell since the last generation, whose previous generation no longer applies
+	unsigned long long generation;
+} GameBatch;
+
+typedef struct CycleDetector_ {
+	int maxPeriod; // the longest period looked for; also the length of the ring
+	uint64_t *hashes; // ring of the hashes of the last generations observed
+	uint64_t *gridWords; // ring of the same generations in packed rows, gridWordCount words each; allocated by the first observation
+	size_t gridWordCount;
+	int count; // generations in the rings
+	int newest; // ring index of lastGeneration
+	unsigned long long lastGeneration;
+	int period; // the confirmed period, 1 for a still life or an empty Grid; 0 until one is found
+	unsigned long long entryGeneration; // the first generation of the cycle, once period is set
+} CycleDetector;
+
 typedef struct PrintOptions_ {
 	char signForOff;
 	char signForOn;
 } PrintOptions;
 
+typedef struct Renderer_ {
+	long long gridSizeX; // rows drawn
+	long long gridSizeY; // cells per row drawn
+	PrintOptions options;
+	bool changedRowsOnly; // after the first frame, redraw only the rows that differ from the last frame
+	bool drawn; // a full frame is on the terminal
+	char *frame; // GOL__RENDER__FRAME_OVERHEAD + gridSizeX * ( gridSizeY + GOL__RENDER__ROW_OVERHEAD ) bytes, built anew for every frame
+	char *lastRows; // gridSizeX * gridSizeY glyphs of the last frame
+} Renderer;
+
+typedef struct FrameExchange_ {
+	Game *gamePtr;
+	unsigned long long maxGenerations; // 0 runs forever
+	Grid *gridPtrs[3]; // copies of the current Grid: one written by the simulation, one read by the renderer, and one in between
+	unsigned long long generations[3]; // the generation each copy holds
+	int back; // the copy owned by the simulation thread
+	int front; // the copy owned by the render thread
+#ifdef GOL__THREADS
+	atomic_int middle; // the copy in between, plus GOL__EXCHANGE__FRESH
+	atomic_bool requested; // the renderer wants a newer frame
+	atomic_bool finished; // the simulation has stopped; its last frame is published
+	atomic_bool stopping; // the renderer gave up; the simulation stops after its current generation
+#endif
+} FrameExchange;
+
+typedef struct RleReader_ {
+	FILE *stream;
+	size_t length; // bytes in buffer
+	size_t position; // next byte to parse
+	char buffer[GOL__RLE__BUFFER_SIZE];
+} RleReader;
+
+typedef struct RleWriter_ {
+	FILE *stream;
+	size_t length; // bytes in buffer
+	int lineLength; // chars on the current line
+	char buffer[GOL__RLE__BUFFER_SIZE];
+} RleWriter;
+
+typedef struct Viewport_ {
+	long long originX; // the Grid cell in the top left corner of the window; may lie outside the Grid
+	long long originY;
+	long long zoom; // a dot is zoom by zoom cells
+	long long rows; // lines of glyphs on the terminal
+	long long columns; // glyphs per line
+	char glyphs; // GOL__GLYPHS__DENSITY, GOL__GLYPHS__HALF_BLOCK, or GOL__GLYPHS__BRAILLE
+	uint64_t *words; // one packed row of the window, words[-1 .. wordCapacity]
+	size_t wordCapacity;
+	uint32_t *dotCounts; // live cells per dot of one line of glyphs
+	char *frame; // GOL__RENDER__FRAME_OVERHEAD + rows * ( columns * GOL__GLYPHS__UTF8_SIZE + 2 ) bytes
+} Viewport;
+
+typedef void (*RowKernel)( const uint64_t *above, const uint64_t *mid, const uint64_t *below, uint64_t *out, size_t wordCount, const Rule *rulePtr );
+
+typedef void (*RowStatsFunction)( GenerationStats *statsPtr, long long x, const uint64_t *before, const uint64_t *after, size_t rowWords, uint64_t lastMask );
+
 typedef struct CellIndex_ {
-	char *storageCharPtr;
-	char bitIndex;
+	uint64_t *storageWordPtr;
+	char bitIndex; // 0 .. 63, or GOL__BITBOARD__CELLS_PER_WORD for a cell out of bounds
 } CellIndex;
 
 
 
 /* Grid - create & destroy */
 Grid *createGrid( long long gridSizeX, long long gridSizeY, char outOfBoundsRule );
+Grid *createGridWithStorage( long long gridSizeX, long long gridSizeY, char outOfBoundsRule, char storageMode, size_t rowStride );
+Grid *createGridOnRows( long long gridSizeX, long long gridSizeY, char outOfBoundsRule, char storageMode, char *rows, size_t rowStride, void *storage, size_t storageSize );
 void destroyGrid( Grid *oldGridPtr );
+void releaseGridStorage( Grid *gridPtr );
+size_t gridRowStride( size_t arraySizeY, size_t requestedRowStride );
 
 /* Grid - getter and setter */
 CellIndex selsectCell( Grid *gridPtr, long long x, long long y );
@@ -73,102 +539,389 @@ ErrorChar setCell( Grid *gridPtr, long long x, long long y, CellState newState )
 /* Grid - print */
 void printGrid( Grid *gridPtr, PrintOptions *optionsPtr );
 void printRow( Grid *gridPtr, size_t rowIndex, PrintOptions *optionsPtr );
-void printAllInChar( char storageChar, PrintOptions *options );
-ErrorChar printOneInChar( char storageChar, char bitIndex, PrintOptions *options );
+void printAllInWord( uint64_t storageWord, PrintOptions *options );
+ErrorChar printOneInWord( uint64_t storageWord, char bitIndex, PrintOptions *options );
 
 /* Grid - miscellaneous */
 void randomizeGrid( Grid *gridPtr );
+void randomizeGridWithSeed( Grid *gridPtr, uint64_t seed, double density, ThreadPool *poolPtr );
+ErrorChar fillGridHalo( Grid *gridPtr );
+ErrorChar fillGridGhostRows( Grid *gridPtr );
 
 
 /* Game - create & destroy */
 Game *createGame( long long gridSizeX, long long gridSizeY, char outOfBoundsRule );
+Game *createGameWithStorage( long long gridSizeX, long long gridSizeY, char outOfBoundsRule, char storageMode, size_t rowStride );
+Game *createGameFromGrids( Grid *gridAPtr, Grid *gridBPtr );
 void destroyGame( Game *oldGamePtr );
 
 /* Game - miscellaneous */
 void printGame( Game * gamePtr, PrintOptions *optionsPtr );
 void iterateGame( Game * gamePtr );
+void iterateGameN( Game *gamePtr, unsigned long long generations );
 void randomizeGame( Game * gamePtr );
+void randomizeGameWithSeed( Game *gamePtr, uint64_t seed, double density );
 void printAndIterateGameLoop( Game * gamePtr, PrintOptions *optionsPtr, unsigned int sleepInMilliseconds );
 
+/* Game - stepping engines */
+ErrorChar setGameEngine( Game *gamePtr, char engine );
+ErrorChar setGameRule( Game *gamePtr, const char *notation );
+void iterateGridReference( Grid *srcGridPtr, Grid *trgGridPtr, const Rule *rulePtr );
+ErrorChar iterateGridScalar( Grid *srcGridPtr, Grid *trgGridPtr, const Rule *rulePtr );
+ErrorChar iterateGridBitboard( Grid *srcGridPtr, Grid *trgGridPtr, const Rule *rulePtr, GenerationStats *statsPtr );
+ErrorChar iterateGridBitboardRows( Grid *srcGridPtr, Grid *trgGridPtr, long long firstRow, long long endRow, RowKernel rowKernel, const Rule *rulePtr,
+	GenerationStats *statsPtr );
+ErrorChar setGameThreadCount( Game *gamePtr, int threadCount );
+ErrorChar prepareGameThreadPool( Game *gamePtr, int threadCount );
+ErrorChar iterateGameParallel( Game *gamePtr, Grid *srcGridPtr, Grid *trgGridPtr, GenerationStats *statsPtr );
+ErrorChar iterateGameTiled( Game *gamePtr, Grid *srcGridPtr, Grid *trgGridPtr );
+ErrorChar iterateGameTemporal( Game *gamePtr, Grid *srcGridPtr, Grid *trgGridPtr, int generations, GenerationStats *statsPtr );
+uint8_t *createLifeBlockTable( const Rule *rulePtr );
+ErrorChar iterateGridLookup( Grid *srcGridPtr, Grid *trgGridPtr, const uint8_t *blockTable );
+void invalidateGameActivity( Game *gamePtr );
+
+/* Game - statistics */
+const GenerationStats *getGameStats( Game *gamePtr );
+ErrorChar measureGameStats( Game *gamePtr );
+void resetGenerationStats( GenerationStats *statsPtr );
+void mergeGenerationStats( GenerationStats *statsPtr, const GenerationStats *otherPtr );
+
+/* Game - cycle detection */
+CycleDetector *createCycleDetector( int maxPeriod );
+void destroyCycleDetector( CycleDetector *oldDetectorPtr );
+void resetCycleDetector( CycleDetector *detectorPtr );
+ErrorChar observeGameCycle( CycleDetector *detectorPtr, Game *gamePtr );
+unsigned long long runGameUntilCycle( Game *gamePtr, CycleDetector *detectorPtr, unsigned long long maxGenerations );
+
+
+/* Rule */
+ErrorChar parseRule( const char *notation, Rule *rulePtr );
+void formatRule( const Rule *rulePtr, char *notation );
+
+
+/* Bitboard - packed rows */
+size_t bitboardRowWords( Grid *gridPtr );
+void packGridRow( Grid *gridPtr, long long x, size_t firstWord, size_t wordCount, uint64_t *words );
+void unpackGridRow( Grid *gridPtr, long long x, size_t firstWord, size_t wordCount, const uint64_t *words );
+void stepBitboardRow( const uint64_t *above, const uint64_t *mid, const uint64_t *below, uint64_t *out, size_t wordCount, const Rule *rulePtr );
+
+/* Bitboard - row kernels */
+ErrorChar selectRowKernel( char kernel );
+bool rowKernelSupported( char kernel );
+char activeRowKernel();
+const char *rowKernelName( char kernel );
+RowKernel getRowKernel( const Rule *rulePtr );
+RowStatsFunction getRowStatsFunction();
+
+
+/* HashLife - create & destroy */
+HashLife *createHashLife();
+void destroyHashLife( HashLife *oldUniversePtr );
+
+/* HashLife - import & export */
+ErrorChar importGameIntoHashLife( HashLife *universePtr, Game *gamePtr );
+void exportHashLifeToGame( HashLife *universePtr, Game *gamePtr );
+
+/* HashLife - stepping */
+ErrorChar advanceHashLife( HashLife *universePtr, int log2Generations );
+ErrorChar stepHashLife( HashLife *universePtr, unsigned long long generations );
+unsigned long long hashLifePopulation( HashLife *universePtr );
+void collectHashLifeGarbage( HashLife *universePtr );
+
+/* HashLife - nodes */
+HashLifeNode *joinHashLifeNodes( HashLife *universePtr, HashLifeNode *nw, HashLifeNode *ne, HashLifeNode *sw, HashLifeNode *se );
+HashLifeNode *emptyHashLifeNode( HashLife *universePtr, int level );
+HashLifeNode *advanceHashLifeNode( HashLife *universePtr, HashLifeNode *node, int log2Generations );
+
+
+/* Plane - create & destroy */
+Plane *createPlane();
+void destroyPlane( Plane *oldPlanePtr );
+
+/* Plane - getter and setter */
+CellState getPlaneCell( Plane *planePtr, long long x, long long y );
+ErrorChar setPlaneCell( Plane *planePtr, long long x, long long y, CellState newState );
+
+/* Plane - import & export */
+ErrorChar importGameIntoPlane( Plane *planePtr, Game *gamePtr );
+void exportPlaneToGame( Plane *planePtr, Game *gamePtr, long long originX, long long originY );
+
+/* Plane - stepping */
+ErrorChar iteratePlane( Plane *planePtr );
+unsigned long long planePopulation( Plane *planePtr );
+
+/* Plane - chunk map */
+PlaneChunk *findPlaneChunk( Plane *planePtr, long long chunkX, long long chunkY );
+PlaneChunk *insertPlaneChunk( Plane *planePtr, long long chunkX, long long chunkY );
+void removePlaneChunk( Plane *planePtr, long long chunkX, long long chunkY );
+
+
+/* Game batch - create & destroy */
+GameBatch *createGameBatch( long long gridSizeX, long long gridSizeY, char outOfBoundsRule );
+void destroyGameBatch( GameBatch *oldBatchPtr );
+
+/* Game batch - cells */
+CellState getGameBatchCell( GameBatch *batchPtr, int lane, long long x, long long y );
+ErrorChar setGameBatchCell( GameBatch *batchPtr, int lane, long long x, long long y, CellState newState );
+void randomizeGameBatch( GameBatch *batchPtr, uint64_t seed, double density );
+unsigned long long gameBatchLanePopulation( GameBatch *batchPtr, int lane );
+ErrorChar exportGameBatchLane( GameBatch *batchPtr, int lane, Game *gamePtr );
+
+/* Game batch - stepping */
+ErrorChar setGameBatchRule( GameBatch *batchPtr, const char *notation );
+void iterateGameBatch( GameBatch *batchPtr );
+unsigned long long runGameBatch( GameBatch *batchPtr, unsigned long long maxGenerations );
+
+
+/* Thread pool */
+ThreadPool *createThreadPool( int threadCount );
+void destroyThreadPool( ThreadPool *oldPoolPtr );
+void runThreadPool( ThreadPool *poolPtr, ThreadJob job, void *argument );
+int onlineProcessorCount();
+
 
 /* Moludo functions */
 lldiv_t lldivGreater ( long long dividend, long long divisor );
 lldiv_t lldivPositive ( long long dividend, long long divisor );
 
 
+/* Renderer */
+Renderer *createRenderer( long long gridSizeX, long long gridSizeY, PrintOptions *optionsPtr, bool changedRowsOnly );
+void destroyRenderer( Renderer *oldRendererPtr );
+ErrorChar renderGrid( Renderer *rendererPtr, Grid *gridPtr, const char *title );
+
+/* Renderer - render thread */
+ErrorChar runAndRenderGameLoop( Game *gamePtr, PrintOptions *optionsPtr, unsigned int framesPerSecond, unsigned long long maxGenerations );
+
+/* Renderer - viewport */
+Viewport *createViewport( long long rows, long long columns, char glyphs );
+void destroyViewport( Viewport *oldViewportPtr );
+void fitViewport( Viewport *viewportPtr, Grid *gridPtr );
+void panViewport( Viewport *viewportPtr, long long deltaX, long long deltaY );
+ErrorChar zoomViewport( Viewport *viewportPtr, long long zoom );
+ErrorChar renderViewport( Viewport *viewportPtr, Grid *gridPtr, const char *title );
+
+
+/* Pattern files - RLE */
+Game *readGameRle( FILE *stream, char outOfBoundsRule );
+ErrorChar readRlePattern( FILE *stream, Game *gamePtr, long long originX, long long originY );
+ErrorChar writeGameRle( FILE *stream, Game *gamePtr );
+Game *loadGameRle( const char *path, char outOfBoundsRule );
+ErrorChar saveGameRle( Game *gamePtr, const char *path );
+
+
+/* Snapshots */
+ErrorChar saveGameSnapshot( Game *gamePtr, const char *path );
+ErrorChar startGameSnapshot( Game *gamePtr, const char *path );
+ErrorChar finishGameSnapshot( Game *gamePtr );
+Game *loadGameSnapshot( const char *path, bool verify );
+
+
+/* Out-of-core Grids */
+Game *createGameInFile( long long gridSizeX, long long gridSizeY, char outOfBoundsRule, const char *path );
+long long gridAdviceRows( Grid *gridPtr );
+void adviseGridRows( Grid *gridPtr, long long firstRow, long long endRow, bool needed );
+bool skipsEmptyGridRow( Grid *gridPtr, long long x, const uint64_t *words );
+
+
+/* Performance counters */
+#ifdef GOL__PERF_COUNTERS
+PerfCounters *createPerfCounters( FILE *logStream );
+void destroyPerfCounters( PerfCounters *oldCountersPtr );
+void resetPerfCounters( PerfCounters *countersPtr );
+void beginPerfSample( PerfCounters *countersPtr );
+void endPerfSample( PerfCounters *countersPtr, unsigned long long generations, unsigned long long lastGeneration );
+void printPerfSample( FILE *stream, const char *label, const PerfSample *samplePtr, unsigned long long divisor );
+ErrorChar enableGamePerfCounters( Game *gamePtr, FILE *logStream );
+void disableGamePerfCounters( Game *gamePtr );
+void printGamePerfCounters( Game *gamePtr, FILE *stream );
+#endif
+
+
+/* Benchmark */
+ErrorChar runBenchmarks( unsigned long long generations, char format );
+void seedBenchmarkWorkload( Grid *gridPtr, const BenchmarkWorkload *workloadPtr, uint64_t seed );
+void printBenchmarkResult( const BenchmarkResult *resultPtr, char format, bool first );
+
+
+/* Verification */
+ErrorChar runVerification( unsigned long long generations, uint64_t seed );
+ErrorChar verifyEngines( const BenchmarkWorkload *workloadPtr, uint64_t seed, unsigned long long generations );
+#ifdef GOL__FUZZ
+int LLVMFuzzerTestOneInput( const uint8_t *data, size_t size );
+#endif
+
+
 /* Demos */
 void randomGameDemo();
 void gliderGunDemo();
+void unboundedGliderGunDemo();
+void largeGameDemo();
+void placeGliderGun( Grid *gridPtr );
 
 
 /* Cross-platform */ // Used only for printAndIterateGameLoop and the demos.
+#if defined( __GNUC__ ) && defined( __x86_64__ )
+#define GOL__X86_KERNELS // AVX2 and AVX-512 row kernels, compiled per function with the target attribute and picked at runtime
+#include <immintrin.h>
+#endif
 void clearCmd();
+void *alignedCalloc( size_t size, size_t alignment );
+void alignedFree( void *ptr );
+double monotonicSeconds();
+long peakResidentKilobytes();
+ErrorChar writeStandardOutput( const char *bytes, size_t length );
 #ifdef _WINDOWS
 #include <windows.h>
 #else
 #include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <sys/resource.h>
 #define Sleep(x) usleep((x)*1000)
 #endif
 
 
 
-void main() {
-	randomGameDemo();
-	// gliderGunDemo();
+#ifndef GOL__FUZZ // libFuzzer brings its own main
+int main( int argc, char **argv ) {
+	ErrorChar error = 0;
+	
+	selectRowKernel( GOL__KERNEL__AUTO );
+	if ( argc > 1 && strcmp( argv[1], "--benchmark" ) == 0 ) {
+		unsigned long long generations = GOL__BENCHMARK__GENERATIONS;
+		char format = GOL__BENCHMARK__TEXT;
+		for ( int i = 2; error == 0 && i < argc; ++i ) {
+			char *end;
+			if ( strcmp( argv[i], "--csv" ) == 0 ) {
+				format = GOL__BENCHMARK__CSV;
+			} else if ( strcmp( argv[i], "--json" ) == 0 ) {
+				format = GOL__BENCHMARK__JSON;
+			} else if ( ( generations = strtoull( argv[i], &end, 10 ) ) == 0 || *end != '\0' ) {
+				fprintf( stderr, "ERROR: Invalid argument \"%s\". Usage: %s --benchmark [generations] [--csv | --json]\n", argv[i], argv[0] );
+				error = 1;
+			}
+		}
+		if ( error == 0 ) {
+			error = runBenchmarks( generations, format );
+		}
+	} else if ( argc > 1 && strcmp( argv[1], "--verify" ) == 0 ) {
+		unsigned long long generations = GOL__VERIFY__GENERATIONS;
+		uint64_t seed = GOL__VERIFY__SEED;
+		for ( int i = 2; error == 0 && i < argc; ++i ) {
+			char *end = NULL;
+			if ( strcmp( argv[i], "--seed" ) == 0 && i + 1 < argc ) {
+				seed = strtoull( argv[++i], &end, 10 );
+			} else {
+				generations = strtoull( argv[i], &end, 10 );
+			}
+			if ( end == argv[i] || *end != '\0' || generations == 0 ) {
+				fprintf( stderr, "ERROR: Invalid argument \"%s\". Usage: %s --verify [generations] [--seed n]\n", argv[i], argv[0] );
+				error = 1;
+			}
+		}
+		if ( error == 0 ) {
+			error = runVerification( generations, seed );
+		}
+	} else {
+		randomGameDemo();
+		// gliderGunDemo();
+		// unboundedGliderGunDemo();
+		// largeGameDemo();
+	}
+	
+	return error;
 }
+#endif
 
 
 
 /* Grid - create & destroy */
 
-/* Creates a Grid - a 2-dimensional char array. Allocates the necessary memory. Returns a pointer to it, if successful. Retruns a NULL pointer otherwise. */
+/* Creates a Grid - a 2-dimensional bit array - with contiguous storage and the smallest row stride. Returns a pointer to it, if successful. Retruns a NULL pointer otherwise. */
 Grid *createGrid( long long gridSizeX, long long gridSizeY, char outOfBoundsRule ) {
+	return createGridWithStorage( gridSizeX, gridSizeY, outOfBoundsRule, GOL__STORAGE__CONTIGUOUS, 0 );
+}
+
+/* Creates a Grid - a 2-dimensional bit array. Allocates the necessary memory. Returns a pointer to it, if successful. Retruns a NULL pointer otherwise.
+ * storageMode is GOL__STORAGE__CONTIGUOUS (one aligned allocation for all rows) or GOL__STORAGE__ROWS (one allocation per row).
+ * rowStride is the number of bytes per row; it is rounded up to what the row needs and to GOL__GRID__ALIGNMENT. 0 picks the smallest one. */
+Grid *createGridWithStorage( long long gridSizeX, long long gridSizeY, char outOfBoundsRule, char storageMode, size_t rowStride ) {
 	bool error = false;
 	
-	char **origin;
+	uint64_t **origin;
 	size_t arraySizeX;
 	size_t arraySizeY;
+	void *storage = NULL;
 	
 	Grid *newGridPtr = NULL;
 	
 	if ( gridSizeX < 0 || gridSizeY < 0 ) { // grid size must be positive
-		fprintf( stderr, "ERROR: ( gridSizeX, gridSizeX ) == ( %d, %d ) is invalid. Grid size must be positive.\n", gridSizeX, gridSizeY );
+		fprintf( stderr, "ERROR: ( gridSizeX, gridSizeX ) == ( %lld, %lld ) is invalid. Grid size must be positive.\n", gridSizeX, gridSizeY );
+		error = true;
+	} else if ( storageMode != GOL__STORAGE__ROWS && storageMode != GOL__STORAGE__CONTIGUOUS ) {
+		fprintf( stderr, "ERROR: storageMode == %d is invalid. Valid values are only %d and %d.\n", storageMode, GOL__STORAGE__ROWS, GOL__STORAGE__CONTIGUOUS );
 		error = true;
 	} else {
+		arraySizeX = (size_t) gridSizeX;
+		arraySizeY = (size_t) lldivGreater( gridSizeY + 1, GOL__BITBOARD__CELLS_PER_WORD ).quot;
+		rowStride = gridRowStride( arraySizeY, rowStride );
+		size_t rowCount = arraySizeX + 2; // including the ghost rows
+		
 		newGridPtr = (Grid *) malloc( sizeof( Grid ) );
-		if ( newGridPtr == NULL ) {
+		if ( newGridPtr == NULL || rowCount > ( SIZE_MAX - GOL__GRID__ALIGNMENT ) / ( rowStride + sizeof( uint64_t * ) ) ) {
 			error = true;
+			free( newGridPtr );
+			newGridPtr = NULL;
+		} else if ( storageMode == GOL__STORAGE__CONTIGUOUS ) {
+			/* One block: all rows, then the row pointers. */
+			storage = alignedCalloc( rowCount * rowStride + rowCount * sizeof( uint64_t * ), GOL__GRID__ALIGNMENT );
+			if ( storage == NULL ) {
+				error = true;
+				free( newGridPtr );
+				newGridPtr = NULL;
+			} else {
+				char *rows = (char *) storage;
+				origin = (uint64_t **) ( rows + rowCount * rowStride ) + 1;
+				for ( size_t i = 0; i < rowCount; ++i ) {
+					origin[ (long long) i - 1 ] = (uint64_t *) ( rows + i * rowStride + GOL__GRID__ROW_OFFSET );
+				}
+			}
 		} else {
-			arraySizeX = (size_t) gridSizeX;
-			arraySizeY = (size_t) lldivGreater( gridSizeY, sizeof( char ) ).quot;
-			origin = (char **) calloc( arraySizeX, sizeof( char * ) );
-			if ( origin == NULL ) {
+			uint64_t **rowPointers = (uint64_t **) calloc( rowCount, sizeof( uint64_t * ) );
+			if ( rowPointers == NULL ) {
 				error = true;
 				free( newGridPtr );
 				newGridPtr = NULL;
 			} else {
 				size_t i = 0;
-				while ( error == false && i < arraySizeX ) {
-					origin[i] = (char *) calloc( arraySizeY, sizeof( char ) );
-					if ( origin[i] == NULL ) {
+				while ( error == false && i < rowCount ) {
+					char *row = (char *) calloc( rowStride, sizeof( char ) );
+					if ( row == NULL ) {
 						error = true;
 					} else {
+						rowPointers[i] = (uint64_t *) ( row + GOL__GRID__ROW_OFFSET );
 						++i;
 					}
 				}
 				/* Rollback: */
 				if ( error == true ) {
 					for ( size_t toFreeIndex = 0 ; toFreeIndex < i ; ++toFreeIndex ) {
-						free( origin[toFreeIndex] );
+						free( (char *) rowPointers[toFreeIndex] - GOL__GRID__ROW_OFFSET );
 					}
-					free( origin );
+					free( rowPointers );
 					free( newGridPtr );
 					newGridPtr = NULL;
+				} else {
+					origin = rowPointers + 1;
 				}
 			}
 		}
 		if ( error == true ) { // malloc or calloc failure
-			fprintf( stderr, "ERROR: Could not allocate memory to create grid with dimensions %d by %d.\n", gridSizeX, gridSizeY );
+			fprintf( stderr, "ERROR: Could not allocate memory to create grid with dimensions %lld by %lld.\n", gridSizeX, gridSizeY );
 		}
 	}
 	if ( error == false ) {
@@ -177,22 +930,88 @@ Grid *createGrid( long long gridSizeX, long long gridSizeY, char outOfBoundsRule
 		newGridPtr->gridSizeY = gridSizeY;
 		newGridPtr->arraySizeX = arraySizeX;
 		newGridPtr->arraySizeY = arraySizeY;
+		newGridPtr->rowStride = rowStride;
+		newGridPtr->storage = storage;
+		newGridPtr->storageSize = 0;
+		newGridPtr->storageMode = storageMode;
 		newGridPtr->outOfBoundsRule = outOfBoundsRule;
 	}
 
 	return newGridPtr;
 }
 
+/* Creates a Grid over rows that are already in memory, e.g. in a mapping: rows points at the start of row -1, and row i starts rowStride bytes
+ * after row i - 1. Only the Grid and its row pointers are allocated; releasing the Grid releases storage according to storageMode.
+ * Returns a NULL pointer on malloc failure, in which case storage is left alone. */
+Grid *createGridOnRows( long long gridSizeX, long long gridSizeY, char outOfBoundsRule, char storageMode, char *rows, size_t rowStride, void *storage, size_t storageSize ) {
+	Grid *newGridPtr = (Grid *) malloc( sizeof( Grid ) );
+	size_t rowCount = (size_t) gridSizeX + 2; // including the ghost rows
+	uint64_t **rowPointers = (uint64_t **) malloc( rowCount * sizeof( uint64_t * ) );
+	
+	if ( newGridPtr == NULL || rowPointers == NULL ) {
+		fprintf( stderr, "ERROR: Could not allocate memory to create grid with dimensions %lld by %lld.\n", gridSizeX, gridSizeY );
+		free( newGridPtr );
+		free( rowPointers );
+		newGridPtr = NULL;
+	} else {
+		for ( size_t i = 0; i < rowCount; ++i ) {
+			rowPointers[i] = (uint64_t *) ( rows + i * rowStride + GOL__GRID__ROW_OFFSET );
+		}
+		newGridPtr->origin = rowPointers + 1;
+		newGridPtr->gridSizeX = gridSizeX;
+		newGridPtr->gridSizeY = gridSizeY;
+		newGridPtr->arraySizeX = (size_t) gridSizeX;
+		newGridPtr->arraySizeY = (size_t) lldivGreater( gridSizeY + 1, GOL__BITBOARD__CELLS_PER_WORD ).quot;
+		newGridPtr->rowStride = rowStride;
+		newGridPtr->storage = storage;
+		newGridPtr->storageSize = storageSize;
+		newGridPtr->storageMode = storageMode;
+		newGridPtr->outOfBoundsRule = outOfBoundsRule;
+	}
+	
+	return newGridPtr;
+}
+
 /* Destroys the Grid pointed at by the oldGridPtr. Frees the memory. */
 void destroyGrid( Grid *oldGridPtr ) {
-	char **origin = oldGridPtr->origin;
-	size_t arraySizeX = oldGridPtr->arraySizeX;
+	releaseGridStorage( oldGridPtr );
+	free( oldGridPtr );
+}
+
+/* Frees the rows of the Grid pointed at by gridPtr, but not the Grid itself. Used for Grids embedded in a Game. */
+void releaseGridStorage( Grid *gridPtr ) {
+	if ( gridPtr->storageMode == GOL__STORAGE__CONTIGUOUS ) {
+		alignedFree( gridPtr->storage );
+	} else if ( gridPtr->storageMode == GOL__STORAGE__MAPPED || gridPtr->storageMode == GOL__STORAGE__FILE ) {
+#ifndef _WINDOWS
+		munmap( gridPtr->storage, gridPtr->storageSize );
+#endif
+		free( gridPtr->origin - 1 );
+	} else {
+		uint64_t **rowPointers = gridPtr->origin - 1;
+		size_t rowCount = gridPtr->arraySizeX + 2;
+		
+		for ( size_t i = 0; i < rowCount ; ++i ) {
+			free( (char *) rowPointers[i] - GOL__GRID__ROW_OFFSET );
+		}
+		free( rowPointers );
+	}
+	gridPtr->origin = NULL;
+	gridPtr->storage = NULL;
+}
+
+/* Returns the row stride in bytes for rows of arraySizeY words: at least requestedRowStride, room for the ghost cells and a multiple of GOL__GRID__ALIGNMENT.
+ * If the smallest stride is a multiple of GOL__GRID__ALIASING_STRIDE, it is padded, so that vertically adjacent cells do not map to the same cache set. */
+size_t gridRowStride( size_t arraySizeY, size_t requestedRowStride ) {
+	size_t minimum = GOL__GRID__ROW_OFFSET + ( arraySizeY + 1 ) * sizeof( uint64_t ); // and a zero word right of the row, which the row kernels read
+	size_t rowStride = ( requestedRowStride > minimum ) ? requestedRowStride : minimum;
 	
-	for ( long long i = 0; i < arraySizeX ; ++i ) {
-		free( origin[i] );
+	rowStride = ( rowStride + GOL__GRID__ALIGNMENT - 1 ) / GOL__GRID__ALIGNMENT * GOL__GRID__ALIGNMENT;
+	if ( requestedRowStride == 0 && rowStride % GOL__GRID__ALIASING_STRIDE == 0 ) {
+		rowStride += GOL__GRID__ALIGNMENT;
 	}
-	free( origin );
-	free( oldGridPtr );
+	
+	return rowStride;
 }
 
 
@@ -208,10 +1027,10 @@ CellIndex selsectCell( Grid *gridPtr, long long x, long long y ) {
 	if ( x >= 0 && y >= 0 && x < gridSizeX && y < gridSizeY ) {
 		size_t i = (size_t) x;
 		
-		lldiv_t division = lldiv( y, sizeof( char ) );
+		lldiv_t division = lldiv( y, GOL__BITBOARD__CELLS_PER_WORD );
 		size_t j = (size_t) division.quot;
 		
-		targetIndex.storageCharPtr = &(gridPtr->origin[i][j]);
+		targetIndex.storageWordPtr = &(gridPtr->origin[i][j]);
 		targetIndex.bitIndex = (char) division.rem;
 		
 	} else {
@@ -226,27 +1045,27 @@ CellIndex selsectCell( Grid *gridPtr, long long x, long long y ) {
 			// TEST: x = -1 => x = gridSizeX;
 			
 		} else { // Out-of-bounds cell is not selectable. getCell uses outOfBoundsRule to determine its value.
-			targetIndex.storageCharPtr = NULL;
-			targetIndex.bitIndex = (char) sizeof( char );
+			targetIndex.storageWordPtr = NULL;
+			targetIndex.bitIndex = GOL__BITBOARD__CELLS_PER_WORD;
 		}
 	}
 	
 	return targetIndex;
 }
 
-/* Reads a single cell. This corresponds to a single bit in the 2-dimensional char array that is a Grid. Returns GOL__OOBR__ALL_OFF, GOL__OOBR__ALL_ON, or GOL__OOBR__ALL_INVALID. */
+/* Reads a single cell. This corresponds to a single bit in the 2-dimensional bit array that is a Grid. Returns GOL__OOBR__ALL_OFF, GOL__OOBR__ALL_ON, or GOL__OOBR__ALL_INVALID. */
 CellState getCell( Grid *gridPtr, long long x, long long y ) {
 	CellIndex targetIndex = selsectCell( gridPtr, x, y);
-	char *storageCharPtr = targetIndex.storageCharPtr;
+	uint64_t *storageWordPtr = targetIndex.storageWordPtr;
 	char bitIndex = targetIndex.bitIndex;
 	
 	char outOfBoundsRule = gridPtr->outOfBoundsRule;
 	
 	CellState state;
 	
-	if ( storageCharPtr == NULL ) {
-		if ( bitIndex != (char) sizeof( char ) ) { // invalid bitIndex // This shouldn't be possible.
-			fprintf( stderr, "ERROR: bitIndex == %d is invalid for storageCharPtr == NULL. Valid value is only %d. selectCell for buggy? Invalid Grid?\n", bitIndex, (char) sizeof( char ) );
+	if ( storageWordPtr == NULL ) {
+		if ( bitIndex != GOL__BITBOARD__CELLS_PER_WORD ) { // invalid bitIndex // This shouldn't be possible.
+			fprintf( stderr, "ERROR: bitIndex == %d is invalid for storageWordPtr == NULL. Valid value is only %d. selectCell for buggy? Invalid Grid?\n", bitIndex, GOL__BITBOARD__CELLS_PER_WORD );
 			state = GOL__CELL_STATE__INVALID;
 		} else {
 			if ( outOfBoundsRule == GOL__OOBR__ALL_OFF ) {
@@ -259,7 +1078,7 @@ CellState getCell( Grid *gridPtr, long long x, long long y ) {
 			}
 		}
 	} else {
-		if ( ( *storageCharPtr &&  (char) ( 1 << bitIndex ) ) == 0 ) {
+		if ( ( *storageWordPtr & ( 1ULL << bitIndex ) ) == 0 ) {
 			state = GOL__CELL_STATE__OFF;
 		} else {
 			state = GOL__CELL_STATE__ON;
@@ -269,22 +1088,22 @@ CellState getCell( Grid *gridPtr, long long x, long long y ) {
 	return state;
 }
 
-/* Writes a single cell. This corresponds to a single bit in the 2-dimensional char array that is a Grid. Returns 0 on success; > 0 on error. */
+/* Writes a single cell. This corresponds to a single bit in the 2-dimensional bit array that is a Grid. Returns 0 on success; > 0 on error. */
 ErrorChar setCell( Grid *gridPtr, long long x, long long y, CellState newState ) {
 	CellIndex targetIndex = selsectCell( gridPtr, x, y);
-	char *storageCharPtr = targetIndex.storageCharPtr;
+	uint64_t *storageWordPtr = targetIndex.storageWordPtr;
 	char bitIndex = targetIndex.bitIndex;
 	
 	ErrorChar error = 0;
 	
-	if ( bitIndex == (char) sizeof( char ) ) { // Cell is out-of-bounds and thus not settable.
+	if ( bitIndex == GOL__BITBOARD__CELLS_PER_WORD ) { // Cell is out-of-bounds and thus not settable.
 		error = 1;
-		fprintf( stderr, "ERROR: bitIndex == %d is invalid. Cell with ( x, y ) == ( %d, %d ) is out-of-bounds and thus not settable.\n", bitIndex, x, y );
+		fprintf( stderr, "ERROR: bitIndex == %d is invalid. Cell with ( x, y ) == ( %lld, %lld ) is out-of-bounds and thus not settable.\n", bitIndex, x, y );
 	} else {
 		if ( newState == GOL__CELL_STATE__OFF ) {
-			*storageCharPtr &= !( (char) ( 1 << bitIndex ) );
+			*storageWordPtr &= ~( 1ULL << bitIndex );
 		} else if ( newState == GOL__CELL_STATE__ON ) {
-			*storageCharPtr |= (char) ( 1 << bitIndex );
+			*storageWordPtr |= 1ULL << bitIndex;
 		} else { // invalid newState
 			error = 2;
 			fprintf( stderr, "ERROR: newState == %d is invalid. Valid values are only %d and %d.\n", newState, GOL__CELL_STATE__OFF, GOL__CELL_STATE__ON );
@@ -310,30 +1129,28 @@ void printGrid( Grid *gridPtr, PrintOptions *optionsPtr ) {
 
 /* Prints a whole row of cells in sequence to stdout. */
 void printRow( Grid *gridPtr, size_t rowIndex, PrintOptions *optionsPtr ) {
-	char *rowOrigin = gridPtr->origin[rowIndex];
+	uint64_t *rowOrigin = gridPtr->origin[rowIndex];
 	
-	lldiv_t division = lldiv( gridPtr->gridSizeY, sizeof( char ) );
+	lldiv_t division = lldiv( gridPtr->gridSizeY, GOL__BITBOARD__CELLS_PER_WORD );
 	size_t quotient = (size_t) division.quot;
 	char remainder = (char) division.rem;
 	
 	for ( size_t j = 0; j < quotient; ++j ) {
-		printAllInChar( rowOrigin[j], optionsPtr );
+		printAllInWord( rowOrigin[j], optionsPtr );
 	}
 	for ( char bitIndex = 0; bitIndex < remainder; ++bitIndex ) {
-		printOneInChar( rowOrigin[quotient], bitIndex, optionsPtr );
+		printOneInWord( rowOrigin[quotient], bitIndex, optionsPtr );
 	}
 	putc( '\n', stdout );
 }
 
-/* Prints all cells in a char in sequence to stdout. */
-void printAllInChar( char storageChar, PrintOptions *options ) {
+/* Prints all cells in a word in sequence to stdout. */
+void printAllInWord( uint64_t storageWord, PrintOptions *options ) {
 	char signForOff = options->signForOff;
 	char signForOn = options->signForOn;
 	
-	char sizeOfChar = sizeof( char );
-	
-	for ( char bitIndex = 0; bitIndex < sizeOfChar; ++bitIndex ) {
-		if ( storageChar && 1 << bitIndex ) {
+	for ( char bitIndex = 0; bitIndex < GOL__BITBOARD__CELLS_PER_WORD; ++bitIndex ) {
+		if ( storageWord & ( 1ULL << bitIndex ) ) {
 			putc( signForOn, stdout );
 		} else {
 			putc( signForOff, stdout );
@@ -341,20 +1158,20 @@ void printAllInChar( char storageChar, PrintOptions *options ) {
 	}
 }
 
-/* Prints a single cell in a char to stdout. Returns 0 on success; > 0 on invalid bitIndex. */
-ErrorChar printOneInChar( char storageChar, char bitIndex, PrintOptions *options ) {
+/* Prints a single cell in a word to stdout. Returns 0 on success; > 0 on invalid bitIndex. */
+ErrorChar printOneInWord( uint64_t storageWord, char bitIndex, PrintOptions *options ) {
 	ErrorChar error = 0;
 	
 	char signForOff = options->signForOff;
 	char signForOn = options->signForOn;
 	
-	if ( bitIndex >= sizeof( char ) ) {
+	if ( bitIndex < 0 || bitIndex >= GOL__BITBOARD__CELLS_PER_WORD ) {
 		error = 1;
 	} else {
-		if ( storageChar && 1 << bitIndex ) {
-			putc( signForOff, stdout );
-		} else {
+		if ( storageWord & ( 1ULL << bitIndex ) ) {
 			putc( signForOn, stdout );
+		} else {
+			putc( signForOff, stdout );
 		}		
 	}
 	return error;
@@ -363,19 +1180,163 @@ ErrorChar printOneInChar( char storageChar, char bitIndex, PrintOptions *options
 
 /* Grid - miscellaneous */
 
-/* Randomize each cell of the grid individually. Not very efficient. The distribution is questionable. */
+/* Randomizes each cell of the Grid with probability 1 / 2 on the calling thread. The seed is drawn from rand(), so srand still picks the soup. */
 void randomizeGrid( Grid *gridPtr ) {
-	long long  gridSizeX = gridPtr->gridSizeX;
-	long long  gridSizeY = gridPtr->gridSizeY;
-	for ( long long i = 0; i < gridSizeX; ++i ) {
-		for ( long long j = 0; j < gridSizeY; ++j ) {
-			if ( rand() % 2 ) {
-				setCell( gridPtr, i, j, GOL__CELL_STATE__OFF );
-			} else {
-				setCell( gridPtr, i, j, GOL__CELL_STATE__ON );
+	uint64_t seed = (uint64_t) rand();
+	seed = ( seed << 31 ) ^ (uint64_t) rand();
+	randomizeGridWithSeed( gridPtr, seed, 0.5, NULL );
+}
+
+typedef struct RandomJob_ {
+	Grid *gridPtr;
+	uint64_t seed;
+	unsigned int digits; // density * 2^GOL__RANDOM__DENSITY_BITS
+} RandomJob;
+
+/* Returns random word counter of the stream seed: the splitmix64 finalizer of a Weyl sequence, which can be evaluated at any counter. */
+static inline uint64_t randomWord( uint64_t seed, uint64_t counter ) {
+	uint64_t random = seed + ( counter + 1 ) * 0x9E3779B97F4A7C15ULL;
+	random = ( random ^ ( random >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+	random = ( random ^ ( random >> 27 ) ) * 0x94D049BB133111EBULL;
+	return random ^ ( random >> 31 );
+}
+
+/* Thread share of randomizeGridWithSeed: one contiguous band of rows. */
+static void randomizeBand( void *argument, int threadIndex, int threadCount ) {
+	RandomJob *jobPtr = (RandomJob *) argument;
+	Grid *gridPtr = jobPtr->gridPtr;
+	unsigned int digits = jobPtr->digits;
+	size_t rowWords = bitboardRowWords( gridPtr );
+	long long gridSizeX = gridPtr->gridSizeX;
+	long long firstRow = gridSizeX / threadCount * threadIndex + ( threadIndex < gridSizeX % threadCount ? threadIndex : gridSizeX % threadCount );
+	long long endRow = firstRow + gridSizeX / threadCount + ( threadIndex < gridSizeX % threadCount ? 1 : 0 );
+	int lastDigit = ( digits == 0 || digits >= 1U << GOL__RANDOM__DENSITY_BITS ) ? GOL__RANDOM__DENSITY_BITS : __builtin_ctz( digits );
+	uint64_t words[GOL__RANDOM__CHUNK_WORDS];
+	
+	for ( long long x = firstRow; x < endRow; ++x ) {
+		for ( size_t firstWord = 0; firstWord < rowWords; firstWord += GOL__RANDOM__CHUNK_WORDS ) {
+			size_t wordCount = ( rowWords - firstWord < GOL__RANDOM__CHUNK_WORDS ) ? rowWords - firstWord : GOL__RANDOM__CHUNK_WORDS;
+			for ( size_t k = 0; k < wordCount; ++k ) {
+				uint64_t counter = ( (uint64_t) x * rowWords + firstWord + k ) * GOL__RANDOM__DENSITY_BITS;
+				uint64_t word = ( digits >= 1U << GOL__RANDOM__DENSITY_BITS ) ? ~0ULL : 0;
+				uint64_t undecided = ~0ULL; // cells whose random digits so far equal those of density
+				for ( int d = GOL__RANDOM__DENSITY_BITS - 1; d >= lastDigit && undecided != 0; --d ) { // past the last 1 digit nothing can turn alive
+					uint64_t random = randomWord( jobPtr->seed, counter + (uint64_t) d );
+					if ( ( digits >> d ) & 1 ) {
+						word |= undecided & ~random;
+						undecided &= random;
+					} else {
+						undecided &= ~random;
+					}
+				}
+				words[k] = word;
+			}
+			unpackGridRow( gridPtr, x, firstWord, wordCount, words );
+		}
+	}
+}
+
+/* Sets each cell of the Grid alive with probability density, rounded to a multiple of 1 / 2^GOL__RANDOM__DENSITY_BITS, 64 cells per random word.
+ * Every cell compares a uniform random fraction with density, one binary digit at a time from the first, all 64 cells of a word at once:
+ * a cell is decided at the first digit where the two differ, which halves the undecided cells per random word, so a word rarely needs
+ * more than eight of them, and density 1 / 2 needs one. Random words are numbered by their position in the Grid,
+ * so the soup depends only on seed, density and the Grid size, not on the storage or on how the rows are split over the threads of poolPtr,
+ * which may be NULL to run on the calling thread. Ghost cells are left alone. */
+void randomizeGridWithSeed( Grid *gridPtr, uint64_t seed, double density, ThreadPool *poolPtr ) {
+	RandomJob job;
+	
+	job.gridPtr = gridPtr;
+	job.seed = seed;
+	job.digits = ( density <= 0.0 ) ? 0 : ( density >= 1.0 ) ? 1U << GOL__RANDOM__DENSITY_BITS : (unsigned int) ( density * (double) ( 1U << GOL__RANDOM__DENSITY_BITS ) + 0.5 );
+	if ( gridPtr->gridSizeY > 0 ) {
+		if ( poolPtr != NULL ) {
+			runThreadPool( poolPtr, randomizeBand, &job );
+		} else {
+			randomizeBand( &job, 0, 1 );
+		}
+	}
+}
+
+
+/* Sets a ghost row of the Grid, from column -1 to column gridSizeY, all on ( on == true ) or all off; the bits beyond stay 0. */
+static void fillGhostRow( Grid *gridPtr, uint64_t *row, bool on ) {
+	size_t ghostWord = (size_t) gridPtr->gridSizeY / GOL__BITBOARD__CELLS_PER_WORD;
+	uint64_t ghostBit = 1ULL << ( gridPtr->gridSizeY % GOL__BITBOARD__CELLS_PER_WORD );
+	
+	row[-1] = (uint64_t) on << 63;
+	memset( row, on ? 0xFF : 0, ghostWord * sizeof( uint64_t ) );
+	row[ghostWord] = on ? ( ghostBit << 1 ) - 1 : 0; // ghostBit << 1 is 0 for bit 63
+}
+
+/* Writes the cells just outside the Grid - the ghost rows -1 and gridSizeX and the ghost columns -1 and gridSizeY - according to outOfBoundsRule:
+ * all off, all on, or copies of the opposite edge for GOL__OOBR__TORUS. Afterwards every neighbor of every cell can be read from origin directly.
+ * Costs O( gridSizeX + gridSizeY / 64 ). Returns 0 on success; > 0 on invalid outOfBoundsRule. */
+ErrorChar fillGridHalo( Grid *gridPtr ) {
+	ErrorChar error = 0;
+	
+	uint64_t **origin = gridPtr->origin;
+	long long gridSizeX = gridPtr->gridSizeX;
+	long long gridSizeY = gridPtr->gridSizeY;
+	char outOfBoundsRule = gridPtr->outOfBoundsRule;
+	size_t ghostWord = (size_t) gridSizeY / GOL__BITBOARD__CELLS_PER_WORD;
+	uint64_t ghostBit = 1ULL << ( gridSizeY % GOL__BITBOARD__CELLS_PER_WORD );
+	size_t haloWords = gridPtr->arraySizeY + 1; // a ghost row, from word -1 to the word of column gridSizeY
+	
+	if ( outOfBoundsRule == GOL__OOBR__ALL_OFF || outOfBoundsRule == GOL__OOBR__ALL_ON ) {
+		bool on = outOfBoundsRule == GOL__OOBR__ALL_ON;
+		for ( long long i = 0; i < gridSizeX; ++i ) {
+			origin[i][-1] = (uint64_t) on << 63;
+			origin[i][ghostWord] = ( origin[i][ghostWord] & ( ghostBit - 1 ) ) | ( on ? ghostBit : 0 );
+		}
+		fillGhostRow( gridPtr, origin[-1], on );
+		fillGhostRow( gridPtr, origin[gridSizeX], on );
+	} else if ( outOfBoundsRule == GOL__OOBR__TORUS ) {
+		if ( gridSizeX > 0 && gridSizeY > 0 ) {
+			size_t lastWord = (size_t) ( gridSizeY - 1 ) / GOL__BITBOARD__CELLS_PER_WORD;
+			int lastBit = (int) ( ( gridSizeY - 1 ) % GOL__BITBOARD__CELLS_PER_WORD );
+			for ( long long i = 0; i < gridSizeX; ++i ) {
+				uint64_t *row = origin[i];
+				bool right = row[0] & 1;
+				row[-1] = ( ( row[lastWord] >> lastBit ) & 1 ) << 63;
+				row[ghostWord] = ( row[ghostWord] & ( ghostBit - 1 ) ) | ( right ? ghostBit : 0 );
 			}
+			/* The rows already carry their ghost columns, so the corners wrap as well. */
+			memcpy( origin[-1] - 1, origin[ gridSizeX - 1 ] - 1, haloWords * sizeof( uint64_t ) );
+			memcpy( origin[gridSizeX] - 1, origin[0] - 1, haloWords * sizeof( uint64_t ) );
+		}
+	} else {
+		error = 1;
+		fprintf( stderr, "ERROR: outOfBoundsRule == %d is invalid. Valid values are only %d, %d and %d.\n", outOfBoundsRule, GOL__OOBR__ALL_OFF, GOL__OOBR__ALL_ON, GOL__OOBR__TORUS );
+	}
+	
+	return error;
+}
+
+/* Writes only the ghost rows -1 and gridSizeX according to outOfBoundsRule, for the bitboard engine on file-backed Grids: it derives
+ * the ghost columns of each packed row itself, so that a generation does not touch the first and last page of every row an extra time.
+ * The ghost columns of the ghost rows are not valid afterwards. Returns 0 on success; > 0 on invalid outOfBoundsRule. */
+ErrorChar fillGridGhostRows( Grid *gridPtr ) {
+	ErrorChar error = 0;
+	
+	uint64_t **origin = gridPtr->origin;
+	long long gridSizeX = gridPtr->gridSizeX;
+	char outOfBoundsRule = gridPtr->outOfBoundsRule;
+	size_t haloWords = gridPtr->arraySizeY + 1;
+	
+	if ( outOfBoundsRule == GOL__OOBR__ALL_OFF || outOfBoundsRule == GOL__OOBR__ALL_ON ) {
+		fillGhostRow( gridPtr, origin[-1], outOfBoundsRule == GOL__OOBR__ALL_ON );
+		fillGhostRow( gridPtr, origin[gridSizeX], outOfBoundsRule == GOL__OOBR__ALL_ON );
+	} else if ( outOfBoundsRule == GOL__OOBR__TORUS ) {
+		if ( gridSizeX > 0 ) {
+			memcpy( origin[-1] - 1, origin[ gridSizeX - 1 ] - 1, haloWords * sizeof( uint64_t ) );
+			memcpy( origin[gridSizeX] - 1, origin[0] - 1, haloWords * sizeof( uint64_t ) );
 		}
+	} else {
+		error = 1;
+		fprintf( stderr, "ERROR: outOfBoundsRule == %d is invalid. Valid values are only %d, %d and %d.\n", outOfBoundsRule, GOL__OOBR__ALL_OFF, GOL__OOBR__ALL_ON, GOL__OOBR__TORUS );
 	}
+	
+	return error;
 }
 
 
@@ -383,34 +1344,56 @@ void randomizeGrid( Grid *gridPtr ) {
 
 /* Creates a Game - a pair of Grid of equal size with a currentGridPtr. Allocates the necessary memory. Returns a pointer to it, if successful. Returns a NULL pointer otherwise. */
 Game *createGame( long long gridSizeX, long long gridSizeY, char outOfBoundsRule ) {
-	bool error = false;
-	
+	return createGameWithStorage( gridSizeX, gridSizeY, outOfBoundsRule, GOL__STORAGE__CONTIGUOUS, 0 );
+}
+
+/* Creates a Game whose Grids use the given storageMode and rowStride (see createGridWithStorage). Returns a NULL pointer on failure. */
+Game *createGameWithStorage( long long gridSizeX, long long gridSizeY, char outOfBoundsRule, char storageMode, size_t rowStride ) {
 	Grid *gridAPtr;
 	Grid *gridBPtr;
 	
 	Game *newGamePtr = NULL;
 	
-	newGamePtr = (Game *) malloc( sizeof( Game ) );
-	if ( newGamePtr == NULL ){
-		error = true;
-	} else {
-		gridAPtr = createGrid( gridSizeX, gridSizeY, outOfBoundsRule );
-		if ( gridAPtr == NULL ) {
-			free ( newGamePtr );
-			error = true;
+	gridAPtr = createGridWithStorage( gridSizeX, gridSizeY, outOfBoundsRule, storageMode, rowStride );
+	if ( gridAPtr != NULL ) {
+		gridBPtr = createGridWithStorage( gridSizeX, gridSizeY, outOfBoundsRule, storageMode, rowStride );
+		if ( gridBPtr == NULL ) {
+			destroyGrid( gridAPtr );
 		} else {
-			gridBPtr = createGrid( gridSizeX, gridSizeY, outOfBoundsRule );
-			if ( gridBPtr == NULL ) {
-				free ( gridAPtr );
-				free ( newGamePtr );
-				error = true;
-			}
+			newGamePtr = createGameFromGrids( gridAPtr, gridBPtr );
 		}
 	}
-	if ( error == false ) {
+	
+	return newGamePtr;
+}
+
+/* Creates a Game around two Grids of equal size, which it takes over: their storage now belongs to the Game and the Grid structs are freed.
+ * Returns a pointer to the Game, if successful. Returns a NULL pointer otherwise, in which case both Grids are destroyed. */
+Game *createGameFromGrids( Grid *gridAPtr, Grid *gridBPtr ) {
+	Game *newGamePtr = (Game *) malloc( sizeof( Game ) );
+	
+	if ( newGamePtr == NULL ){
+		destroyGrid( gridAPtr );
+		destroyGrid( gridBPtr );
+	} else {
+		/* The Grids are embedded by value. */
 		newGamePtr->gridA = *gridAPtr;
 		newGamePtr->gridB = *gridBPtr;
+		free( gridAPtr );
+		free( gridBPtr );
 		newGamePtr->currentGridPtr = &(newGamePtr->gridA);
+		newGamePtr->engine = GOL__ENGINE__SCALAR;
+		parseRule( "B3/S23", &(newGamePtr->rule) );
+		newGamePtr->threadCount = 0;
+		newGamePtr->threadPoolPtr = NULL;
+		newGamePtr->tileActivityPtr = NULL;
+		newGamePtr->lookupTablePtr = NULL;
+		newGamePtr->generation = 0;
+		newGamePtr->snapshotJobPtr = NULL;
+		resetGenerationStats( &(newGamePtr->stats) );
+#ifdef GOL__PERF_COUNTERS
+		newGamePtr->perfCountersPtr = NULL;
+#endif
 	}
 	
 	return newGamePtr;
@@ -418,15 +1401,27 @@ Game *createGame( long long gridSizeX, long long gridSizeY, char outOfBoundsRule
 
 /* Destroys the Game pointed at by the oldGamePtr. Frees the memory. */
 void destroyGame( Game *oldGamePtr ) {
-	 destroyGrid( &(oldGamePtr->gridA) );
-	 destroyGrid( &(oldGamePtr->gridB) );
+	 finishGameSnapshot( oldGamePtr );
+	 if ( oldGamePtr->threadPoolPtr != NULL ) {
+		 destroyThreadPool( oldGamePtr->threadPoolPtr );
+	 }
+	 if ( oldGamePtr->tileActivityPtr != NULL ) {
+		 free( oldGamePtr->tileActivityPtr->flags );
+		 free( oldGamePtr->tileActivityPtr );
+	 }
+	 free( oldGamePtr->lookupTablePtr );
+#ifdef GOL__PERF_COUNTERS
+	 disableGamePerfCounters( oldGamePtr );
+#endif
+	 releaseGridStorage( &(oldGamePtr->gridA) );
+	 releaseGridStorage( &(oldGamePtr->gridB) );
 	 free( oldGamePtr );
 }
 
 
 /* Game - miscellaneous */
 
-/* One iteration of the Game pointed at by the gamePtr according to the rules of John Conway's Game of Life. */
+/* One iteration of the Game pointed at by the gamePtr according to its Rule, by default the rules of John Conway's Game of Life. */
 void iterateGame( Game * gamePtr ) {
 	bool error = false;
 	
@@ -444,104 +1439,5101 @@ void iterateGame( Game * gamePtr ) {
 		error = true;
 	}
 	if ( error == false ) {
-		long long  gridSizeX = srcGridPtr->gridSizeX;
-		long long  gridSizeY = srcGridPtr->gridSizeY;
-		for ( long long i = 0; i < gridSizeX; ++i ) {
-			for ( long long j = 0; j < gridSizeY; ++j ) {
-				char neighbors = 0;
-				neighbors +=
-					getCell( srcGridPtr, i-1, j-1 ) +
-					getCell( srcGridPtr, i-1, j   ) +
-					getCell( srcGridPtr, i-1, j+1 ) +
-					getCell( srcGridPtr, i  , j-1 ) +
-					getCell( srcGridPtr, i  , j+1 ) +
-					getCell( srcGridPtr, i+1, j-1 ) +
-					getCell( srcGridPtr, i+1, j   ) +
-					getCell( srcGridPtr, i+1, j+1 ); // At the current state, this assumes that 0 is off and 1 is on. I will make this indepent of the values of magic numbers, in a later revision. // TODO
-				/* Rules of the Game of Life */
-				if ( getCell( srcGridPtr, i, j ) == GOL__CELL_STATE__OFF ){
-					if ( neighbors == 3) {
-						setCell( trgGridPtr, i, j, GOL__CELL_STATE__ON );
-					} else {
-						setCell( trgGridPtr, i, j, GOL__CELL_STATE__OFF );
-					}
-				} else { // cell starts dead
-					if ( neighbors < 2 || neighbors > 3 ) {
-						setCell( trgGridPtr, i, j, GOL__CELL_STATE__OFF );
-					} else {
-						setCell( trgGridPtr, i, j, GOL__CELL_STATE__ON );
-					}
+		ErrorChar engineError = 0;
+		GenerationStats stats;
+		
+		resetGenerationStats( &stats );
+		if ( gamePtr->snapshotJobPtr != NULL && gamePtr->snapshotJobPtr->gridPtr == trgGridPtr ) {
+			finishGameSnapshot( gamePtr );
+		}
+		GOL__PERF_BEGIN( gamePtr );
+		switch ( gamePtr->engine ) {
+			case GOL__ENGINE__SCALAR:
+				engineError = iterateGridScalar( srcGridPtr, trgGridPtr, &(gamePtr->rule) );
+				break;
+			case GOL__ENGINE__BITBOARD:
+				engineError = iterateGridBitboard( srcGridPtr, trgGridPtr, &(gamePtr->rule), &stats );
+				break;
+			case GOL__ENGINE__PARALLEL:
+				engineError = iterateGameParallel( gamePtr, srcGridPtr, trgGridPtr, &stats );
+				break;
+			case GOL__ENGINE__TILED:
+				engineError = iterateGameTiled( gamePtr, srcGridPtr, trgGridPtr );
+				break;
+			case GOL__ENGINE__LOOKUP:
+				if ( gamePtr->lookupTablePtr == NULL ) {
+					gamePtr->lookupTablePtr = createLifeBlockTable( &(gamePtr->rule) );
 				}
-			}
+				engineError = ( gamePtr->lookupTablePtr == NULL ) ? 1 : iterateGridLookup( srcGridPtr, trgGridPtr, gamePtr->lookupTablePtr );
+				break;
+			default:
+				engineError = 1;
+				break;
 		}
+		if ( gamePtr->engine != GOL__ENGINE__TILED || engineError != 0 ) { // the tiles did not see this generation
+			invalidateGameActivity( gamePtr );
+		}
+		if ( engineError != 0 ) { // GOL__ENGINE__REFERENCE, or fall back, so that the generation is not lost
+			iterateGridReference( srcGridPtr, trgGridPtr, &(gamePtr->rule) );
+		}
+		++gamePtr->generation;
+		GOL__PERF_END( gamePtr, 1 );
+		gamePtr->stats.generation = GOL__STATS__STALE;
+		if ( engineError == 0 && ( gamePtr->engine == GOL__ENGINE__BITBOARD || gamePtr->engine == GOL__ENGINE__PARALLEL ) ) {
+			stats.generation = gamePtr->generation;
+			gamePtr->stats = stats;
+		}
+	}
+}
+
+/* Advances the Game pointed at by the gamePtr by generations generations; the result is the same as that many calls of iterateGame.
+ * The bitboard and parallel engines compute up to GOL__TEMPORAL__GENERATIONS of them per pass over the Grids (see iterateGameTemporal),
+ * the other engines and any failed pass go one generation at a time. */
+void iterateGameN( Game *gamePtr, unsigned long long generations ) {
+	bool blocked = gamePtr->engine == GOL__ENGINE__BITBOARD || gamePtr->engine == GOL__ENGINE__PARALLEL;
+	
+	while ( generations > 0 ) {
+		int passGenerations = ( generations < GOL__TEMPORAL__GENERATIONS ) ? (int) generations : GOL__TEMPORAL__GENERATIONS;
+		Grid *srcGridPtr = gamePtr->currentGridPtr;
+		Grid *trgGridPtr = ( srcGridPtr == &(gamePtr->gridA) ) ? &(gamePtr->gridB) : &(gamePtr->gridA);
+		
+		if ( gamePtr->snapshotJobPtr != NULL && gamePtr->snapshotJobPtr->gridPtr == trgGridPtr ) {
+			finishGameSnapshot( gamePtr );
+		}
+		GenerationStats stats;
+		bool passed = false;
+		
+		if ( blocked == true && passGenerations > 1 ) {
+			GOL__PERF_BEGIN( gamePtr );
+			passed = iterateGameTemporal( gamePtr, srcGridPtr, trgGridPtr, passGenerations, &stats ) == 0;
+		}
+		if ( passed == true ) {
+			gamePtr->currentGridPtr = trgGridPtr;
+			invalidateGameActivity( gamePtr );
+			gamePtr->generation += (unsigned long long) passGenerations;
+			GOL__PERF_END( gamePtr, (unsigned long long) passGenerations );
+			generations -= (unsigned long long) passGenerations;
+			stats.generation = gamePtr->generation;
+			gamePtr->stats = stats;
+		} else {
+			iterateGame( gamePtr );
+			--generations;
+		}
+	}
+}
+
+/* Prints the current state of a Game into stdout. */
+void printGame( Game * gamePtr, PrintOptions *optionsPtr ) {
+	printGrid( gamePtr->currentGridPtr, optionsPtr );
+}
+
+/* Randomizes all cells in a Game with probability 1 / 2. The seed is drawn from rand(), so srand still picks the soup. */
+void randomizeGame( Game * gamePtr ){
+	uint64_t seed = (uint64_t) rand();
+	seed = ( seed << 31 ) ^ (uint64_t) rand();
+	randomizeGameWithSeed( gamePtr, seed, 0.5 );
+}
+
+/* Fills the current Grid of the Game with a random soup of the given density (see randomizeGridWithSeed). Large Grids are filled by the thread pool
+ * of the Game, with as many threads as GOL__ENGINE__PARALLEL would use; the soup is the same for every thread count. */
+void randomizeGameWithSeed( Game *gamePtr, uint64_t seed, double density ) {
+	Grid *gridPtr = gamePtr->currentGridPtr;
+	ThreadPool *poolPtr = NULL;
+	
+	finishGameSnapshot( gamePtr );
+	if ( (double) gridPtr->gridSizeX * (double) gridPtr->gridSizeY >= (double) GOL__RANDOM__PARALLEL_CELLS && gridPtr->gridSizeX > 1 ) {
+		int threadCount = ( gamePtr->threadCount > 0 ) ? gamePtr->threadCount : onlineProcessorCount();
+		if ( prepareGameThreadPool( gamePtr, threadCount ) == 0 ) {
+			poolPtr = gamePtr->threadPoolPtr;
+		}
+	}
+	randomizeGridWithSeed( gridPtr, seed, density, poolPtr );
+	invalidateGameActivity( gamePtr );
+}
+
+/* An endless loop to showcase the evolution of a Game of Life Game. Draws to stdout through a Renderer, redrawing only the rows that change. */
+void printAndIterateGameLoop( Game * gamePtr, PrintOptions *optionsPtr, unsigned int sleepInMilliseconds ) {
+	bool running = true;
+	
+	Renderer *rendererPtr = createRenderer( gamePtr->currentGridPtr->gridSizeX, gamePtr->currentGridPtr->gridSizeY, optionsPtr, true );
+	
+	fflush( stdout );
+	while ( running == true && rendererPtr != NULL ) {
+		running = renderGrid( rendererPtr, gamePtr->currentGridPtr, "GAME OF LIFE" ) == 0;
+		iterateGame( gamePtr );
+		
+		Sleep( sleepInMilliseconds );
+	}
+	if ( rendererPtr != NULL ) {
+		destroyRenderer( rendererPtr );
+	}
+}
+
+
+/* Game - stepping engines */
+
+/* Selects the stepping engine used by iterateGame. Returns 0 on success; > 0 on invalid engine. */
+ErrorChar setGameEngine( Game *gamePtr, char engine ) {
+	ErrorChar error = 0;
+	
+	if ( engine >= GOL__ENGINE__SCALAR && engine <= GOL__ENGINE__LOOKUP ) {
+		gamePtr->engine = engine;
+	} else {
+		error = 1;
+		fprintf( stderr, "ERROR: engine == %d is invalid. Valid values are only %d to %d.\n", engine, GOL__ENGINE__SCALAR, GOL__ENGINE__LOOKUP );
+	}
+	
+	return error;
+}
+
+/* Sets the rule of the Game from B/S notation, e.g. "B3/S23" (see parseRule). Returns 0 on success; > 0 on invalid notation, in which case nothing changes. */
+ErrorChar setGameRule( Game *gamePtr, const char *notation ) {
+	Rule rule;
+	ErrorChar error = parseRule( notation, &rule );
+	
+	if ( error == 0 ) {
+		gamePtr->rule = rule;
+		free( gamePtr->lookupTablePtr ); // built for the old rule
+		gamePtr->lookupTablePtr = NULL;
+		invalidateGameActivity( gamePtr ); // unchanged tiles may change under another rule
+	}
+	
+	return error;
+}
+
+/* One generation from srcGridPtr into trgGridPtr, one cell at a time through getCell and setCell. Slow, but the reference for all other engines. */
+void iterateGridReference( Grid *srcGridPtr, Grid *trgGridPtr, const Rule *rulePtr ) {
+	long long  gridSizeX = srcGridPtr->gridSizeX;
+	long long  gridSizeY = srcGridPtr->gridSizeY;
+	for ( long long i = 0; i < gridSizeX; ++i ) {
+		for ( long long j = 0; j < gridSizeY; ++j ) {
+			char neighbors = 0;
+			neighbors +=
+				getCell( srcGridPtr, i-1, j-1 ) +
+				getCell( srcGridPtr, i-1, j   ) +
+				getCell( srcGridPtr, i-1, j+1 ) +
+				getCell( srcGridPtr, i  , j-1 ) +
+				getCell( srcGridPtr, i  , j+1 ) +
+				getCell( srcGridPtr, i+1, j-1 ) +
+				getCell( srcGridPtr, i+1, j   ) +
+				getCell( srcGridPtr, i+1, j+1 ); // At the current state, this assumes that 0 is off and 1 is on. I will make this indepent of the values of magic numbers, in a later revision. // TODO
+			/* Rules of the Game of Life, or of another life-like rule */
+			if ( getCell( srcGridPtr, i, j ) == GOL__CELL_STATE__OFF ){
+				if ( ( rulePtr->birth >> neighbors ) & 1 ) {
+					setCell( trgGridPtr, i, j, GOL__CELL_STATE__ON );
+				} else {
+					setCell( trgGridPtr, i, j, GOL__CELL_STATE__OFF );
+				}
+			} else { // cell starts dead
+				if ( ( ( rulePtr->survival >> neighbors ) & 1 ) == 0 ) {
+					setCell( trgGridPtr, i, j, GOL__CELL_STATE__OFF );
+				} else {
+					setCell( trgGridPtr, i, j, GOL__CELL_STATE__ON );
+				}
+			}
+		}
+	}
+}
+
+/* Returns the cell in column y ( -1 <= y <= gridSizeY ) of a row of a Grid as 0 or 1. */
+static inline int rowCell( const uint64_t *row, long long y ) {
+	unsigned long long shifted = (unsigned long long) ( y + GOL__BITBOARD__CELLS_PER_WORD ); // never negative, so the division is a shift
+	return (int) ( row[ (long long) ( shifted / GOL__BITBOARD__CELLS_PER_WORD ) - 1 ] >> ( shifted % GOL__BITBOARD__CELLS_PER_WORD ) ) & 1;
+}
+
+/* One generation from srcGridPtr into trgGridPtr, one cell at a time straight from the rows. Returns 0 on success; > 0 on invalid outOfBoundsRule. */
+ErrorChar iterateGridScalar( Grid *srcGridPtr, Grid *trgGridPtr, const Rule *rulePtr ) {
+	ErrorChar error = fillGridHalo( srcGridPtr );
+	
+	if ( error == 0 ) {
+		uint16_t transitions[2] = { rulePtr->birth, rulePtr->survival }; // indexed by the current state
+		long long  gridSizeX = srcGridPtr->gridSizeX;
+		long long  gridSizeY = srcGridPtr->gridSizeY;
+		for ( long long i = 0; i < gridSizeX; ++i ) {
+			const uint64_t *above = srcGridPtr->origin[ i - 1 ];
+			const uint64_t *row = srcGridPtr->origin[i];
+			const uint64_t *below = srcGridPtr->origin[ i + 1 ];
+			uint64_t *target = trgGridPtr->origin[i];
+			/* Live cells per column of the 3 by 3 neighborhood, rolled one column to the right per cell. */
+			int west = rowCell( above, -1 ) + rowCell( row, -1 ) + rowCell( below, -1 );
+			int centre = rowCell( above, 0 ) + rowCell( row, 0 ) + rowCell( below, 0 );
+			for ( size_t k = 0; k < srcGridPtr->arraySizeY; ++k ) { // word k + 1 is at most the zero word right of the row
+				/* Shifted right by one per cell, so that bit 0 is the column right of the cell, or the cell itself for cells. */
+				uint64_t aboveEast = ( above[k] >> 1 ) | ( above[ k + 1 ] << 63 );
+				uint64_t rowEast = ( row[k] >> 1 ) | ( row[ k + 1 ] << 63 );
+				uint64_t belowEast = ( below[k] >> 1 ) | ( below[ k + 1 ] << 63 );
+				uint64_t cells = row[k];
+				uint64_t word = 0;
+				long long remaining = gridSizeY - (long long) k * GOL__BITBOARD__CELLS_PER_WORD;
+				int cellCount = ( remaining < GOL__BITBOARD__CELLS_PER_WORD ) ? (int) remaining : GOL__BITBOARD__CELLS_PER_WORD;
+				for ( int bitIndex = 0; bitIndex < cellCount; ++bitIndex ) {
+					int east = (int) ( ( aboveEast & 1 ) + ( rowEast & 1 ) + ( belowEast & 1 ) );
+					int state = (int) ( cells & 1 );
+					int neighbors = west + centre + east - state;
+					/* Rules of the Game of Life, without branches */
+					word |= (uint64_t) ( ( transitions[state] >> neighbors ) & 1 ) << bitIndex;
+					west = centre;
+					centre = east;
+					aboveEast >>= 1;
+					rowEast >>= 1;
+					belowEast >>= 1;
+					cells >>= 1;
+				}
+				target[k] = word; // the ghost bit in the last word is refilled before it is read
+			}
+		}
+	}
+	
+	return error;
+}
+
+/* Sets the ghost cells of a packed row ( columns -1 and gridSizeY ) according to the outOfBoundsRule of the Grid and clears the word right of the row. */
+static inline void setPackedGhostColumns( Grid *gridPtr, uint64_t *words, size_t rowWords ) {
+	size_t ghostWord = (size_t) gridPtr->gridSizeY / GOL__BITBOARD__CELLS_PER_WORD;
+	uint64_t ghostBit = 1ULL << ( gridPtr->gridSizeY % GOL__BITBOARD__CELLS_PER_WORD );
+	bool left = gridPtr->outOfBoundsRule == GOL__OOBR__ALL_ON;
+	bool right = left;
+	
+	if ( gridPtr->outOfBoundsRule == GOL__OOBR__TORUS ) {
+		long long lastColumn = gridPtr->gridSizeY - 1;
+		left = ( words[ lastColumn / GOL__BITBOARD__CELLS_PER_WORD ] >> ( lastColumn % GOL__BITBOARD__CELLS_PER_WORD ) ) & 1;
+		right = words[0] & 1;
+	}
+	words[-1] = (uint64_t) left << 63;
+	words[ghostWord] = ( words[ghostWord] & ( ghostBit - 1 ) ) | ( right ? ghostBit : 0 ); // bits right of the ghost cell are left over from the kernel
+	words[rowWords] = 0;
+}
+
+/* One generation from srcGridPtr into trgGridPtr, 64 cells per uint64_t word. If statsPtr is not NULL, the GenerationStats it points at, which
+ * must be reset, receive the population, changed cells and bounding box of the new generation.
+ * Returns 0 on success; > 0 on error (invalid outOfBoundsRule or malloc failure), in which case trgGridPtr may be partially written. */
+ErrorChar iterateGridBitboard( Grid *srcGridPtr, Grid *trgGridPtr, const Rule *rulePtr, GenerationStats *statsPtr ) {
+	ErrorChar error = ( srcGridPtr->storageMode == GOL__STORAGE__FILE ) ? fillGridGhostRows( srcGridPtr ) : fillGridHalo( srcGridPtr );
+	
+	if ( error == 0 ) {
+		error = iterateGridBitboardRows( srcGridPtr, trgGridPtr, 0, srcGridPtr->gridSizeX, getRowKernel( rulePtr ), rulePtr, statsPtr );
+	}
+	
+	return error;
+}
+
+/* Computes rows firstRow .. endRow - 1 of the next generation with the bitboard engine. The halo of srcGridPtr must be filled.
+ * The rows are already packed, so the kernel reads the source rows and writes the target rows in place. Safe to run concurrently on disjoint row ranges.
+ * With file-backed Grids only the ghost rows need to be filled; the kernel works on a rolling window of three copied rows whose ghost columns
+ * are derived per row, and the rows are walked in bands of gridAdviceRows rows: the band after the next one is read ahead, and both Grids'
+ * rows behind the window are dropped from memory.
+ * The rows are added to the GenerationStats pointed at by statsPtr, unless it is NULL.
+ * Returns 0 on success; > 0 on malloc failure. */
+ErrorChar iterateGridBitboardRows( Grid *srcGridPtr, Grid *trgGridPtr, long long firstRow, long long endRow, RowKernel rowKernel, const Rule *rulePtr,
+	GenerationStats *statsPtr ) {
+	ErrorChar error = 0;
+	
+	size_t rowWords = bitboardRowWords( srcGridPtr );
+	size_t bufferWords = rowWords + 2; // one ghost word on each side
+	uint64_t *buffer = NULL;
+	long long adviceRows = gridAdviceRows( srcGridPtr ); // 0 unless the Grids live in a file
+	long long keptRow = firstRow; // the first target row not yet dropped
+	uint64_t lastMask = ( 1ULL << ( srcGridPtr->gridSizeY % GOL__BITBOARD__CELLS_PER_WORD ) ) - 1;
+	RowStatsFunction rowStats = getRowStatsFunction();
+	
+	if ( adviceRows == 0 ) {
+		for ( long long i = firstRow; i < endRow && srcGridPtr->gridSizeY > 0; ++i ) {
+			uint64_t *out = trgGridPtr->origin[i];
+			rowKernel( srcGridPtr->origin[ i - 1 ], srcGridPtr->origin[i], srcGridPtr->origin[ i + 1 ], out, rowWords, rulePtr );
+			out[ rowWords - 1 ] &= lastMask; // the ghost bit and the bits beyond it are left over from the kernel
+			if ( statsPtr != NULL ) {
+				rowStats( statsPtr, i, srcGridPtr->origin[i], out, rowWords, lastMask );
+			}
+		}
+	} else if ( firstRow < endRow && srcGridPtr->gridSizeY > 0 ) {
+		buffer = (uint64_t *) malloc( 4 * bufferWords * sizeof( uint64_t ) );
+		if ( buffer == NULL ) {
+			error = 1;
+			fprintf( stderr, "ERROR: Could not allocate memory for the bitboard rows of a grid with dimensions %lld by %lld.\n", srcGridPtr->gridSizeX, srcGridPtr->gridSizeY );
+		}
+	}
+	if ( buffer != NULL ) {
+		/* Each pointer points at word 0 of its row; word -1 is the left ghost word. */
+		uint64_t *above = buffer + 1;
+		uint64_t *mid = above + bufferWords;
+		uint64_t *below = mid + bufferWords;
+		uint64_t *out = below + bufferWords;
+		
+		/* The rows are copied rather than used in place so that neither the ghost columns nor empty target rows dirty pages of the file. */
+		adviseGridRows( srcGridPtr, firstRow - 1, firstRow + 2 * adviceRows + 1, true );
+		packGridRow( srcGridPtr, firstRow - 1, 0, rowWords, above );
+		packGridRow( srcGridPtr, firstRow, 0, rowWords, mid );
+		setPackedGhostColumns( srcGridPtr, above, rowWords );
+		setPackedGhostColumns( srcGridPtr, mid, rowWords );
+		for ( long long i = firstRow; i < endRow; ++i ) {
+			packGridRow( srcGridPtr, i + 1, 0, rowWords, below );
+			setPackedGhostColumns( srcGridPtr, below, rowWords );
+			rowKernel( above, mid, below, out, rowWords, rulePtr );
+			if ( statsPtr != NULL ) {
+				rowStats( statsPtr, i, mid, out, rowWords, lastMask );
+			}
+			if ( skipsEmptyGridRow( trgGridPtr, i, out ) == false ) {
+				unpackGridRow( trgGridPtr, i, 0, rowWords, out );
+			}
+			if ( i + 1 - keptRow == adviceRows ) {
+				adviseGridRows( srcGridPtr, i + adviceRows + 2, i + 2 * adviceRows + 2, true );
+				adviseGridRows( srcGridPtr, keptRow - 1, i, false ); // rows i and i + 1 are still in the window
+				adviseGridRows( trgGridPtr, keptRow, i + 1, false );
+				keptRow = i + 1;
+			}
+			
+			uint64_t *recycled = above;
+			above = mid;
+			mid = below;
+			below = recycled;
+		}
+		adviseGridRows( srcGridPtr, keptRow - 1, endRow + 1, false );
+		adviseGridRows( trgGridPtr, keptRow, endRow, false );
+	}
+	free( buffer );
+	
+	return error;
+}
+
+/* Sets the number of threads GOL__ENGINE__PARALLEL uses; 0 means one per online CPU. The pool is (re)created on the next parallel generation.
+ * Returns 0 on success; > 0 on negative threadCount. */
+ErrorChar setGameThreadCount( Game *gamePtr, int threadCount ) {
+	ErrorChar error = 0;
+	
+	if ( threadCount < 0 ) {
+		error = 1;
+		fprintf( stderr, "ERROR: threadCount == %d is invalid. It must not be negative.\n", threadCount );
+	} else {
+		gamePtr->threadCount = threadCount;
+	}
+	
+	return error;
+}
+
+/* Makes sure the Game has a thread pool of threadCount threads, replacing one of another size. Returns 0 on success; > 0 on failure. */
+ErrorChar prepareGameThreadPool( Game *gamePtr, int threadCount ) {
+	ErrorChar error = 0;
+	
+	if ( gamePtr->threadPoolPtr == NULL || gamePtr->threadPoolPtr->threadCount != threadCount ) {
+		if ( gamePtr->threadPoolPtr != NULL ) {
+			destroyThreadPool( gamePtr->threadPoolPtr );
+		}
+		gamePtr->threadPoolPtr = createThreadPool( threadCount );
+		if ( gamePtr->threadPoolPtr == NULL ) {
+			error = 1;
+		}
+	}
+	
+	return error;
+}
+
+typedef struct BandJob_ {
+	Grid *srcGridPtr;
+	Grid *trgGridPtr;
+	RowKernel rowKernel;
+	const Rule *rulePtr;
+	GenerationStats *threadStats; // one per thread, or NULL
+	ErrorChar errors[1]; // one per thread, allocated with the job
+} BandJob;
+
+/* Thread share of iterateGameParallel: one contiguous band of rows. */
+static void iterateBand( void *argument, int threadIndex, int threadCount ) {
+	BandJob *jobPtr = (BandJob *) argument;
+	long long gridSizeX = jobPtr->srcGridPtr->gridSizeX;
+	long long firstRow = gridSizeX / threadCount * threadIndex + ( threadIndex < gridSizeX % threadCount ? threadIndex : gridSizeX % threadCount );
+	long long endRow = firstRow + gridSizeX / threadCount + ( threadIndex < gridSizeX % threadCount ? 1 : 0 );
+	
+	GenerationStats *statsPtr = ( jobPtr->threadStats != NULL ) ? &(jobPtr->threadStats[threadIndex]) : NULL;
+	
+	jobPtr->errors[threadIndex] = iterateGridBitboardRows( jobPtr->srcGridPtr, jobPtr->trgGridPtr, firstRow, endRow, jobPtr->rowKernel, jobPtr->rulePtr, statsPtr );
+}
+
+/* One generation of the Game with GOL__ENGINE__PARALLEL: the rows are split into equal bands, which the thread pool steps concurrently.
+ * The halo is filled once up front; the pool's barrier at the end of the job is the point after which the Grids may be swapped.
+ * Each thread gathers the GenerationStats of its band; they are merged into the ones statsPtr points at, unless it is NULL.
+ * Returns 0 on success; > 0 on error, in which case trgGridPtr may be partially written. */
+ErrorChar iterateGameParallel( Game *gamePtr, Grid *srcGridPtr, Grid *trgGridPtr, GenerationStats *statsPtr ) {
+	ErrorChar error = ( srcGridPtr->storageMode == GOL__STORAGE__FILE ) ? fillGridGhostRows( srcGridPtr ) : fillGridHalo( srcGridPtr );
+	
+	int threadCount = ( gamePtr->threadCount > 0 ) ? gamePtr->threadCount : onlineProcessorCount();
+	BandJob *jobPtr = NULL;
+	
+	if ( error == 0 && prepareGameThreadPool( gamePtr, threadCount ) != 0 ) {
+		error = 2;
+	}
+	if ( error == 0 ) {
+		jobPtr = (BandJob *) malloc( sizeof( BandJob ) + (size_t) threadCount * sizeof( ErrorChar ) );
+		if ( jobPtr == NULL ) {
+			error = 3;
+		} else {
+			jobPtr->threadStats = NULL;
+			if ( statsPtr != NULL ) {
+				jobPtr->threadStats = (GenerationStats *) malloc( (size_t) threadCount * sizeof( GenerationStats ) );
+				if ( jobPtr->threadStats == NULL ) {
+					error = 3;
+				}
+				for ( int t = 0; error == 0 && t < threadCount; ++t ) {
+					resetGenerationStats( &(jobPtr->threadStats[t]) );
+				}
+			}
+		}
+	}
+	if ( error == 0 ) {
+		jobPtr->srcGridPtr = srcGridPtr;
+		jobPtr->trgGridPtr = trgGridPtr;
+		jobPtr->rowKernel = getRowKernel( &(gamePtr->rule) ); // selected here, not racily by the workers
+		jobPtr->rulePtr = &(gamePtr->rule);
+		runThreadPool( gamePtr->threadPoolPtr, iterateBand, jobPtr );
+		for ( int t = 0; t < threadCount; ++t ) {
+			if ( jobPtr->errors[t] != 0 ) {
+				error = 4;
+			}
+			if ( statsPtr != NULL ) {
+				mergeGenerationStats( statsPtr, &(jobPtr->threadStats[t]) );
+			}
+		}
+	}
+	if ( jobPtr != NULL ) {
+		free( jobPtr->threadStats );
+	}
+	free( jobPtr );
+	
+	return error;
+}
+
+
+/* Advances rows firstRow .. endRow - 1 of srcGridPtr by generations generations into trgGridPtr, within buffer, which holds
+ * 2 * ( endRow - firstRow + 2 * generations ) packed rows of rowWords + 2 words. The band is read with generations extra rows on each side;
+ * every generation the valid part shrinks by one row on each side. Rows outside a non-torus Grid never change, so they are not recomputed.
+ * The rows of the last generation are added to the GenerationStats pointed at by statsPtr; the other buffer still holds the one before. */
+static void iterateBandTemporal( Grid *srcGridPtr, Grid *trgGridPtr, long long firstRow, long long endRow, int generations, uint64_t *buffer,
+	RowKernel rowKernel, const Rule *rulePtr, GenerationStats *statsPtr ) {
+	size_t rowWords = bitboardRowWords( srcGridPtr );
+	size_t bufferWords = rowWords + 2;
+	long long rowCount = endRow - firstRow + 2 * generations;
+	long long baseRow = firstRow - generations; // Grid row of buffer row 0
+	bool torus = srcGridPtr->outOfBoundsRule == GOL__OOBR__TORUS;
+	uint64_t outside = ( srcGridPtr->outOfBoundsRule == GOL__OOBR__ALL_ON ) ? ~0ULL : 0;
+	uint64_t *current = buffer + 1;
+	uint64_t *next = current + (size_t) rowCount * bufferWords;
+	uint64_t lastMask = ( 1ULL << ( srcGridPtr->gridSizeY % GOL__BITBOARD__CELLS_PER_WORD ) ) - 1;
+	RowStatsFunction rowStats = getRowStatsFunction();
+	
+	for ( long long r = 0; r < rowCount; ++r ) {
+		long long x = baseRow + r;
+		uint64_t *words = current + (size_t) r * bufferWords;
+		if ( x >= 0 && x < srcGridPtr->gridSizeX ) {
+			packGridRow( srcGridPtr, x, 0, rowWords, words );
+		} else if ( torus == true ) {
+			packGridRow( srcGridPtr, lldivPositive( x, srcGridPtr->gridSizeX ).rem, 0, rowWords, words );
+		} else {
+			uint64_t *nextWords = next + (size_t) r * bufferWords;
+			for ( long long k = -1; k <= (long long) rowWords; ++k ) {
+				words[k] = outside;
+				nextWords[k] = outside;
+			}
+		}
+	}
+	for ( int g = 1; g <= generations; ++g ) {
+		for ( long long r = g - 1; r < rowCount - g + 1; ++r ) {
+			long long x = baseRow + r;
+			if ( torus == true || ( x >= 0 && x < srcGridPtr->gridSizeX ) ) {
+				setPackedGhostColumns( srcGridPtr, current + (size_t) r * bufferWords, rowWords );
+			}
+		}
+		for ( long long r = g; r < rowCount - g; ++r ) {
+			long long x = baseRow + r;
+			if ( torus == true || ( x >= 0 && x < srcGridPtr->gridSizeX ) ) {
+				uint64_t *mid = current + (size_t) r * bufferWords;
+				rowKernel( mid - bufferWords, mid, mid + bufferWords, next + (size_t) r * bufferWords, rowWords, rulePtr );
+			}
+		}
+		uint64_t *recycled = current;
+		current = next;
+		next = recycled;
+	}
+	for ( long long x = firstRow; x < endRow; ++x ) {
+		uint64_t *words = current + (size_t) ( x - baseRow ) * bufferWords;
+		rowStats( statsPtr, x, next + (size_t) ( x - baseRow ) * bufferWords, words, rowWords, lastMask );
+		if ( trgGridPtr->storageMode != GOL__STORAGE__FILE || skipsEmptyGridRow( trgGridPtr, x, words ) == false ) {
+			unpackGridRow( trgGridPtr, x, 0, rowWords, words );
+		}
+	}
+}
+
+typedef struct TemporalJob_ {
+	Grid *srcGridPtr;
+	Grid *trgGridPtr;
+	long long bandRows;
+	long long bandCount;
+	int generations;
+	size_t threadBufferWords;
+	uint64_t *buffers; // threadBufferWords per thread
+	GenerationStats *threadStats; // one per thread
+	RowKernel rowKernel;
+	const Rule *rulePtr;
+} TemporalJob;
+
+/* Thread share of iterateGameTemporal: every threadCount-th band. With file-backed Grids, the next band of the thread is read ahead
+ * and the rows of a finished band are dropped from memory. */
+static void iterateBandsTemporal( void *argument, int threadIndex, int threadCount ) {
+	TemporalJob *jobPtr = (TemporalJob *) argument;
+	uint64_t *buffer = jobPtr->buffers + (size_t) threadIndex * jobPtr->threadBufferWords;
+	bool advise = jobPtr->srcGridPtr->storageMode == GOL__STORAGE__FILE;
+	long long generations = jobPtr->generations;
+	
+	for ( long long band = threadIndex; band < jobPtr->bandCount; band += threadCount ) {
+		long long firstRow = band * jobPtr->bandRows;
+		long long endRow = ( firstRow + jobPtr->bandRows < jobPtr->srcGridPtr->gridSizeX ) ? firstRow + jobPtr->bandRows : jobPtr->srcGridPtr->gridSizeX;
+		if ( advise == true ) {
+			long long nextRow = firstRow + threadCount * jobPtr->bandRows;
+			adviseGridRows( jobPtr->srcGridPtr, nextRow - generations, nextRow + jobPtr->bandRows + generations, true );
+		}
+		iterateBandTemporal( jobPtr->srcGridPtr, jobPtr->trgGridPtr, firstRow, endRow, jobPtr->generations, buffer, jobPtr->rowKernel, jobPtr->rulePtr,
+			&(jobPtr->threadStats[threadIndex]) );
+		if ( advise == true ) {
+			adviseGridRows( jobPtr->srcGridPtr, firstRow, endRow, false );
+			adviseGridRows( jobPtr->trgGridPtr, firstRow, endRow, false );
+		}
+	}
+}
+
+/* generations generations of the Game in one pass from srcGridPtr into trgGridPtr ( 1 <= generations <= GOL__TEMPORAL__GENERATIONS ).
+ * The Grid is cut into bands of full rows, sized so that a band with its extra rows fits GOL__TEMPORAL__CACHE_BYTES in packed form.
+ * Each band is packed once, advanced generations times in the cache and unpacked once; with GOL__ENGINE__PARALLEL the bands are spread over
+ * the thread pool. The halo is not read: ghost cells are derived from the outOfBoundsRule each generation.
+ * The GenerationStats pointed at by statsPtr are overwritten with those of the last generation.
+ * Returns 0 on success; > 0 on error, in which case trgGridPtr may be partly written and the caller should fall back. */
+ErrorChar iterateGameTemporal( Game *gamePtr, Grid *srcGridPtr, Grid *trgGridPtr, int generations, GenerationStats *statsPtr ) {
+	ErrorChar error = 0;
+	
+	int threadCount = 1;
+	TemporalJob job;
+	
+	if ( srcGridPtr->gridSizeX == 0 || srcGridPtr->gridSizeY == 0 || generations < 1 || generations > GOL__TEMPORAL__GENERATIONS ) {
+		error = 1;
+	} else if ( srcGridPtr->outOfBoundsRule != GOL__OOBR__ALL_OFF && srcGridPtr->outOfBoundsRule != GOL__OOBR__ALL_ON && srcGridPtr->outOfBoundsRule != GOL__OOBR__TORUS ) {
+		error = 2;
+	}
+	if ( error == 0 && gamePtr->engine == GOL__ENGINE__PARALLEL ) {
+		threadCount = ( gamePtr->threadCount > 0 ) ? gamePtr->threadCount : onlineProcessorCount();
+		if ( prepareGameThreadPool( gamePtr, threadCount ) != 0 ) {
+			error = 3;
+		}
+	}
+	if ( error == 0 ) {
+		size_t bufferWords = bitboardRowWords( srcGridPtr ) + 2;
+		long long bandRows = (long long) ( GOL__TEMPORAL__CACHE_BYTES / ( 2 * bufferWords * sizeof( uint64_t ) ) ) - 2 * generations;
+		if ( bandRows < GOL__TEMPORAL__MIN_ROWS ) {
+			bandRows = GOL__TEMPORAL__MIN_ROWS;
+		}
+		if ( bandRows * threadCount > srcGridPtr->gridSizeX ) { // enough bands for every thread
+			bandRows = ( srcGridPtr->gridSizeX + threadCount - 1 ) / threadCount;
+		}
+		job.srcGridPtr = srcGridPtr;
+		job.trgGridPtr = trgGridPtr;
+		job.bandRows = bandRows;
+		job.bandCount = ( srcGridPtr->gridSizeX + bandRows - 1 ) / bandRows;
+		job.generations = generations;
+		job.threadBufferWords = 2 * (size_t) ( bandRows + 2 * generations ) * bufferWords;
+		job.buffers = (uint64_t *) malloc( (size_t) threadCount * job.threadBufferWords * sizeof( uint64_t ) );
+		job.threadStats = (GenerationStats *) malloc( (size_t) threadCount * sizeof( GenerationStats ) );
+		job.rowKernel = getRowKernel( &(gamePtr->rule) );
+		job.rulePtr = &(gamePtr->rule);
+		if ( job.buffers == NULL || job.threadStats == NULL ) {
+			free( job.buffers );
+			free( job.threadStats );
+			error = 4;
+			fprintf( stderr, "ERROR: Could not allocate memory for the band buffers of a grid with dimensions %lld by %lld.\n", srcGridPtr->gridSizeX, srcGridPtr->gridSizeY );
+		}
+	}
+	if ( error == 0 ) {
+		for ( int t = 0; t < threadCount; ++t ) {
+			resetGenerationStats( &(job.threadStats[t]) );
+		}
+		if ( gamePtr->engine == GOL__ENGINE__PARALLEL ) {
+			runThreadPool( gamePtr->threadPoolPtr, iterateBandsTemporal, &job );
+		} else {
+			iterateBandsTemporal( &job, 0, 1 );
+		}
+		resetGenerationStats( statsPtr );
+		for ( int t = 0; t < threadCount; ++t ) {
+			mergeGenerationStats( statsPtr, &(job.threadStats[t]) );
+		}
+		free( job.buffers );
+		free( job.threadStats );
+	}
+	
+	return error;
+}
+
+/* Recomputes one tile: rows firstRow .. endRow - 1 of word column tileColumn. Returns true, if any of its cells changed. */
+static bool iterateTile( Grid *srcGridPtr, Grid *trgGridPtr, long long firstRow, long long endRow, size_t tileColumn, RowKernel rowKernel, const Rule *rulePtr ) {
+	uint64_t buffer[4][3]; // words -1, 0 and 1 of the three rows and the output
+	uint64_t *above = buffer[0] + 1;
+	uint64_t *mid = buffer[1] + 1;
+	uint64_t *below = buffer[2] + 1;
+	uint64_t *out = buffer[3] + 1;
+	long long validColumns = srcGridPtr->gridSizeY - (long long) tileColumn * GOL__BITBOARD__CELLS_PER_WORD;
+	uint64_t validMask = ( validColumns >= GOL__BITBOARD__CELLS_PER_WORD ) ? ~0ULL : ( 1ULL << validColumns ) - 1;
+	bool changed = false;
+	
+	packGridRow( srcGridPtr, firstRow - 1, tileColumn, 1, above );
+	packGridRow( srcGridPtr, firstRow, tileColumn, 1, mid );
+	for ( long long i = firstRow; i < endRow; ++i ) {
+		packGridRow( srcGridPtr, i + 1, tileColumn, 1, below );
+		rowKernel( above, mid, below, out, 1, rulePtr );
+		changed = changed || ( ( out[0] ^ mid[0] ) & validMask ) != 0;
+		unpackGridRow( trgGridPtr, i, tileColumn, 1, out );
+		
+		uint64_t *recycled = above;
+		above = mid;
+		mid = below;
+		below = recycled;
+	}
+	
+	return changed;
+}
+
+/* One generation of the Game with GOL__ENGINE__TILED. A tile whose 3 by 3 neighborhood of tiles did not change in the last generation
+ * will not change in this one either, and the target Grid - which holds the last generation - already has it, so it is skipped entirely.
+ * The work per generation is thus proportional to the active area plus one flag per tile.
+ * Returns 0 on success; > 0 on error (invalid outOfBoundsRule or malloc failure), in which case trgGridPtr may be partially written. */
+ErrorChar iterateGameTiled( Game *gamePtr, Grid *srcGridPtr, Grid *trgGridPtr ) {
+	ErrorChar error = fillGridHalo( srcGridPtr );
+	
+	TileActivity *activityPtr = gamePtr->tileActivityPtr;
+	long long gridSizeX = srcGridPtr->gridSizeX;
+	long long tileRows = ( gridSizeX + GOL__TILE__ROWS - 1 ) / GOL__TILE__ROWS;
+	long long tileColumns = ( srcGridPtr->gridSizeY + GOL__BITBOARD__CELLS_PER_WORD - 1 ) / GOL__BITBOARD__CELLS_PER_WORD;
+	
+	if ( error == 0 && activityPtr == NULL ) {
+		activityPtr = (TileActivity *) malloc( sizeof( TileActivity ) );
+		if ( activityPtr != NULL ) {
+			activityPtr->flags = (unsigned char *) calloc( 2 * (size_t) tileRows * (size_t) tileColumns + 1, 1 );
+			if ( activityPtr->flags == NULL ) {
+				free( activityPtr );
+				activityPtr = NULL;
+			}
+		}
+		if ( activityPtr == NULL ) {
+			error = 2;
+			fprintf( stderr, "ERROR: Could not allocate memory for the tiles of a grid with dimensions %lld by %lld.\n", gridSizeX, srcGridPtr->gridSizeY );
+		} else {
+			activityPtr->tileRows = tileRows;
+			activityPtr->tileColumns = tileColumns;
+			activityPtr->changed = activityPtr->flags;
+			activityPtr->nextChanged = activityPtr->flags + (size_t) tileRows * (size_t) tileColumns;
+			activityPtr->valid = false;
+			gamePtr->tileActivityPtr = activityPtr;
+		}
+	}
+	if ( error == 0 ) {
+		bool torus = ( srcGridPtr->outOfBoundsRule == GOL__OOBR__TORUS );
+		RowKernel rowKernel = getRowKernel( &(gamePtr->rule) );
+		
+		for ( long long tr = 0; tr < tileRows; ++tr ) {
+			for ( long long tc = 0; tc < tileColumns; ++tc ) {
+				bool active = ( activityPtr->valid == false );
+				for ( long long dr = -1; active == false && dr <= 1; ++dr ) {
+					for ( long long dc = -1; active == false && dc <= 1; ++dc ) {
+						long long r = tr + dr;
+						long long c = tc + dc;
+						if ( torus ) {
+							r = ( r + tileRows ) % tileRows;
+							c = ( c + tileColumns ) % tileColumns;
+						}
+						if ( r >= 0 && r < tileRows && c >= 0 && c < tileColumns ) {
+							active = activityPtr->changed[ r * tileColumns + c ] != 0;
+						}
+					}
+				}
+				bool changed = false;
+				if ( active ) {
+					long long firstRow = tr * GOL__TILE__ROWS;
+					long long endRow = ( firstRow + GOL__TILE__ROWS < gridSizeX ) ? firstRow + GOL__TILE__ROWS : gridSizeX;
+					changed = iterateTile( srcGridPtr, trgGridPtr, firstRow, endRow, (size_t) tc, rowKernel, &(gamePtr->rule) );
+				}
+				activityPtr->nextChanged[ tr * tileColumns + tc ] = changed;
+			}
+		}
+		unsigned char *recycled = activityPtr->changed;
+		activityPtr->changed = activityPtr->nextChanged;
+		activityPtr->nextChanged = recycled;
+		activityPtr->valid = true;
+	}
+	
+	return error;
+}
+
+/* Makes the next tiled generation recompute every tile, and getGameStats measure the Grid again. Call it after changing the cells of a Game
+ * other than through iterateGame, e.g. with setCell; randomizeGame does it by itself. */
+void invalidateGameActivity( Game *gamePtr ) {
+	if ( gamePtr->tileActivityPtr != NULL ) {
+		gamePtr->tileActivityPtr->valid = false;
+	}
+	gamePtr->stats.generation = GOL__STATS__STALE;
+}
+
+
+/* Game - lookup engine */
+/* A 4 by 4 block of cells determines the next generation of its centre 2 by 2 cells. Bit ( 4 * r + c ) of a table index is the cell in
+ * row r and column c of the block; bit ( 2 * r + c ) of the entry is the next state of the cell in row r + 1 and column c + 1.
+ * Each Game keeps the table for its own rule, so Games with different rules never rebuild or share one, not even across threads. */
+
+/* Creates the block table for the rule by counting the neighbors of the four centre cells of every 4 by 4 block.
+ * Returns a pointer to its GOL__LOOKUP__ENTRIES entries, if successful. Returns a NULL pointer otherwise. */
+uint8_t *createLifeBlockTable( const Rule *rulePtr ) {
+	uint8_t *newTable = (uint8_t *) malloc( GOL__LOOKUP__ENTRIES );
+	
+	for ( uint32_t block = 0; newTable != NULL && block < GOL__LOOKUP__ENTRIES; ++block ) {
+		uint8_t entry = 0;
+		for ( int r = 1; r <= 2; ++r ) {
+			for ( int c = 1; c <= 2; ++c ) {
+				int neighbors = 0;
+				for ( int dr = -1; dr <= 1; ++dr ) {
+					for ( int dc = -1; dc <= 1; ++dc ) {
+						if ( dr != 0 || dc != 0 ) {
+							neighbors += ( block >> ( 4 * ( r + dr ) + c + dc ) ) & 1;
+						}
+					}
+				}
+				uint16_t transitions = ( ( block >> ( 4 * r + c ) ) & 1 ) ? rulePtr->survival : rulePtr->birth;
+				if ( ( transitions >> neighbors ) & 1 ) {
+					entry |= (uint8_t) ( 1 << ( 2 * ( r - 1 ) + ( c - 1 ) ) );
+				}
+			}
+		}
+		newTable[block] = entry;
+	}
+	if ( newTable == NULL ) {
+		fprintf( stderr, "ERROR: Could not allocate memory for the table of the lookup engine.\n" );
+	}
+	
+	return newTable;
+}
+
+/* Returns the four cells of a packed row starting at column 64 * k + 2 * j - 1 ( 0 <= j < 32 ). shifted is the word from column 64 * k - 1. */
+static inline uint32_t packedRowNibble( const uint64_t *words, size_t k, uint64_t shifted, int j ) {
+	uint32_t nibble;
+	
+	if ( j < 31 ) {
+		nibble = (uint32_t) ( shifted >> ( 2 * j ) ) & 0xF;
+	} else {
+		nibble = (uint32_t) ( shifted >> 62 ) | (uint32_t) ( words[k] >> 63 ) << 2 | (uint32_t) ( words[ k + 1 ] & 1 ) << 3;
+	}
+	
+	return nibble;
+}
+
+/* One generation from srcGridPtr into trgGridPtr, two rows and two columns at a time, each 2 by 2 block by a lookup in blockTable, which
+ * createLifeBlockTable built for the rule. The rows are packed as for the bitboard engine, which supplies the 4 by 4 neighborhoods as four 4-bit slices.
+ * Returns 0 on success; > 0 on invalid outOfBoundsRule or malloc failure. */
+ErrorChar iterateGridLookup( Grid *srcGridPtr, Grid *trgGridPtr, const uint8_t *blockTable ) {
+	ErrorChar error = fillGridHalo( srcGridPtr );
+	
+	size_t rowWords = bitboardRowWords( srcGridPtr );
+	size_t bufferWords = rowWords + 2;
+	uint64_t *buffer = NULL;
+	
+	if ( error == 0 && srcGridPtr->gridSizeX > 0 && srcGridPtr->gridSizeY > 0 ) {
+		buffer = (uint64_t *) malloc( 6 * bufferWords * sizeof( uint64_t ) );
+		if ( buffer == NULL ) {
+			error = 2;
+			fprintf( stderr, "ERROR: Could not allocate memory for the lookup rows of a grid with dimensions %lld by %lld.\n", srcGridPtr->gridSizeX, srcGridPtr->gridSizeY );
+		}
+	}
+	if ( buffer != NULL ) {
+		/* rows[0 .. 3] are Grid rows x - 1 .. x + 2; out[0 .. 1] are rows x and x + 1 of the next generation. */
+		uint64_t *rows[4];
+		uint64_t *out[2];
+		for ( int r = 0; r < 4; ++r ) {
+			rows[r] = buffer + 1 + (size_t) r * bufferWords;
+		}
+		out[0] = buffer + 1 + 4 * bufferWords;
+		out[1] = out[0] + bufferWords;
+		for ( long long x = 0; x < srcGridPtr->gridSizeX; x += 2 ) {
+			bool pair = x + 1 < srcGridPtr->gridSizeX;
+			for ( int r = 0; r < 4; ++r ) {
+				if ( r < 3 || pair == true ) {
+					packGridRow( srcGridPtr, x - 1 + r, 0, rowWords, rows[r] );
+				} else { // row x + 2 would be past the ghost row; it only influences row x + 1, which does not exist
+					memset( rows[r] - 1, 0, bufferWords * sizeof( uint64_t ) );
+				}
+			}
+			for ( size_t k = 0; k < rowWords; ++k ) {
+				uint64_t shifted[4];
+				uint64_t outWords[2] = { 0, 0 };
+				for ( int r = 0; r < 4; ++r ) {
+					shifted[r] = ( rows[r][k] << 1 ) | ( rows[r][ (long long) k - 1 ] >> 63 );
+				}
+				for ( int j = 0; j < 32; ++j ) {
+					uint32_t index = packedRowNibble( rows[0], k, shifted[0], j ) | packedRowNibble( rows[1], k, shifted[1], j ) << 4 |
+						packedRowNibble( rows[2], k, shifted[2], j ) << 8 | packedRowNibble( rows[3], k, shifted[3], j ) << 12;
+					uint64_t entry = blockTable[index];
+					outWords[0] |= ( entry & 3 ) << ( 2 * j );
+					outWords[1] |= ( entry >> 2 ) << ( 2 * j );
+				}
+				out[0][k] = outWords[0];
+				out[1][k] = outWords[1];
+			}
+			unpackGridRow( trgGridPtr, x, 0, rowWords, out[0] );
+			if ( pair == true ) {
+				unpackGridRow( trgGridPtr, x + 1, 0, rowWords, out[1] );
+			}
+		}
+	}
+	free( buffer );
+	
+	return error;
+}
+
+
+/* Game - statistics */
+/* The bitboard and parallel engines and the blocked passes of iterateGameN gather GenerationStats from the packed rows they produce anyway,
+ * with popcount and bit scans, so monitoring them every generation costs next to nothing. After the other engines or a change of cells
+ * the stats are stale, and getGameStats measures the Grid once when asked. */
+
+/* Returns the GenerationStats of the current generation of the Game, measuring the Grid first if the engine did not provide them.
+ * changed counts the cells that differ from the other Grid, which holds the previous generation after iterateGame.
+ * Returns a NULL pointer on malloc failure. */
+const GenerationStats *getGameStats( Game *gamePtr ) {
+	const GenerationStats *statsPtr = &(gamePtr->stats);
+	
+	if ( gamePtr->stats.generation != gamePtr->generation && measureGameStats( gamePtr ) != 0 ) {
+		statsPtr = NULL;
+	}
+	
+	return statsPtr;
+}
+
+/* Measures the GenerationStats of the Game from its Grids, one pair of packed rows at a time, whatever the engine.
+ * Returns 0 on success; > 0 on malloc failure. */
+ErrorChar measureGameStats( Game *gamePtr ) {
+	ErrorChar error = 0;
+	
+	Grid *gridPtr = gamePtr->currentGridPtr;
+	Grid *otherGridPtr = ( gridPtr == &(gamePtr->gridA) ) ? &(gamePtr->gridB) : &(gamePtr->gridA);
+	size_t rowWords = bitboardRowWords( gridPtr );
+	uint64_t lastMask = ( 1ULL << ( gridPtr->gridSizeY % GOL__BITBOARD__CELLS_PER_WORD ) ) - 1;
+	RowStatsFunction rowStats = getRowStatsFunction();
+	uint64_t *buffer = (uint64_t *) malloc( 2 * ( rowWords + 2 ) * sizeof( uint64_t ) );
+	
+	if ( buffer == NULL ) {
+		error = 1;
+		fprintf( stderr, "ERROR: Could not allocate memory for the statistics of a grid with dimensions %lld by %lld.\n", gridPtr->gridSizeX, gridPtr->gridSizeY );
+	} else {
+		uint64_t *words = buffer + 1;
+		uint64_t *otherWords = words + rowWords + 2;
+		resetGenerationStats( &(gamePtr->stats) );
+		for ( long long x = 0; x < gridPtr->gridSizeX; ++x ) {
+			packGridRow( gridPtr, x, 0, rowWords, words );
+			packGridRow( otherGridPtr, x, 0, rowWords, otherWords );
+			rowStats( &(gamePtr->stats), x, otherWords, words, rowWords, lastMask );
+		}
+		gamePtr->stats.generation = gamePtr->generation;
+	}
+	free( buffer );
+	
+	return error;
+}
+
+/* Sets the GenerationStats pointed at by statsPtr to those of an empty Grid, ready to add rows to. They stay stale until a generation is assigned. */
+void resetGenerationStats( GenerationStats *statsPtr ) {
+	statsPtr->generation = GOL__STATS__STALE;
+	statsPtr->population = 0;
+	statsPtr->changed = 0;
+	statsPtr->minX = LLONG_MAX;
+	statsPtr->minY = LLONG_MAX;
+	statsPtr->maxX = -1;
+	statsPtr->maxY = -1;
+	statsPtr->hash = 0;
+}
+
+/* Adds the counts and the hash of the GenerationStats pointed at by otherPtr, gathered on other rows of the same generation, and widens the bounding box. */
+void mergeGenerationStats( GenerationStats *statsPtr, const GenerationStats *otherPtr ) {
+	statsPtr->population += otherPtr->population;
+	statsPtr->changed += otherPtr->changed;
+	statsPtr->hash += otherPtr->hash; // a sum, so that the rows may be hashed in any order and on any thread
+	statsPtr->minX = ( otherPtr->minX < statsPtr->minX ) ? otherPtr->minX : statsPtr->minX;
+	statsPtr->minY = ( otherPtr->minY < statsPtr->minY ) ? otherPtr->minY : statsPtr->minY;
+	statsPtr->maxX = ( otherPtr->maxX > statsPtr->maxX ) ? otherPtr->maxX : statsPtr->maxX;
+	statsPtr->maxY = ( otherPtr->maxY > statsPtr->maxY ) ? otherPtr->maxY : statsPtr->maxY;
+}
+
+
+/* Game - cycle detection */
+/* A CycleDetector keeps the hashes of the last maxPeriod generations in a ring, and the Grids of those generations in packed rows in another.
+ * When the hash of a new generation equals the one of p generations before, the Grid is compared with the copy of that generation, so a match
+ * is exact and the cycle was entered p generations ago; a hash collision costs one compare, never a wrong answer. Scanning from p = 1, the
+ * first match is the shortest period. The hashes come with the GenerationStats of the Game; the copies cost maxPeriod packed Grids. */
+
+/* Creates a CycleDetector for periods from 1 to maxPeriod. Returns a pointer to it, if successful. Returns a NULL pointer otherwise. */
+CycleDetector *createCycleDetector( int maxPeriod ) {
+	CycleDetector *newDetectorPtr = NULL;
+	
+	if ( maxPeriod < 1 ) {
+		fprintf( stderr, "ERROR: maxPeriod == %d is invalid. It must be at least 1.\n", maxPeriod );
+	} else {
+		newDetectorPtr = (CycleDetector *) malloc( sizeof( CycleDetector ) );
+		if ( newDetectorPtr != NULL ) {
+			newDetectorPtr->hashes = (uint64_t *) malloc( (size_t) maxPeriod * sizeof( uint64_t ) );
+			if ( newDetectorPtr->hashes == NULL ) {
+				free( newDetectorPtr );
+				newDetectorPtr = NULL;
+			} else {
+				newDetectorPtr->maxPeriod = maxPeriod;
+				newDetectorPtr->gridWords = NULL;
+				newDetectorPtr->gridWordCount = 0;
+				resetCycleDetector( newDetectorPtr );
+			}
+		}
+		if ( newDetectorPtr == NULL ) {
+			fprintf( stderr, "ERROR: Could not allocate memory for a cycle detector of period %d.\n", maxPeriod );
+		}
+	}
+	
+	return newDetectorPtr;
+}
+
+/* Destroys the CycleDetector pointed at by oldDetectorPtr. Frees the memory. */
+void destroyCycleDetector( CycleDetector *oldDetectorPtr ) {
+	free( oldDetectorPtr->gridWords );
+	free( oldDetectorPtr->hashes );
+	free( oldDetectorPtr );
+}
+
+/* Forgets every generation observed and any period found, e.g. after the cells of the Game were changed. The ring of Grids is kept for reuse. */
+void resetCycleDetector( CycleDetector *detectorPtr ) {
+	detectorPtr->count = 0;
+	detectorPtr->newest = 0;
+	detectorPtr->lastGeneration = 0;
+	detectorPtr->period = 0;
+	detectorPtr->entryGeneration = 0;
+}
+
+/* Packs the cells of the Grid into words, rowWords per row, or compares them with words ( compare == true ). Returns true, if they are equal
+ * or were packed. row needs room for rowWords + 2 words. */
+static bool packOrCompareGridCells( Grid *gridPtr, uint64_t *words, uint64_t *row, bool compare ) {
+	bool equal = true;
+	size_t rowWords = bitboardRowWords( gridPtr );
+	uint64_t lastMask = ( 1ULL << ( gridPtr->gridSizeY % GOL__BITBOARD__CELLS_PER_WORD ) ) - 1;
+	
+	for ( long long x = 0; equal == true && x < gridPtr->gridSizeX; ++x ) {
+		uint64_t *rowWordsPtr = words + (size_t) x * rowWords;
+		packGridRow( gridPtr, x, 0, rowWords, row + 1 );
+		row[rowWords] &= lastMask; // drops the ghost cell in column gridSizeY
+		if ( compare == true ) {
+			equal = memcmp( rowWordsPtr, row + 1, rowWords * sizeof( uint64_t ) ) == 0;
+		} else {
+			memcpy( rowWordsPtr, row + 1, rowWords * sizeof( uint64_t ) );
+		}
+	}
+	
+	return equal;
+}
+
+/* Records the current generation of the Game, which must follow the last one observed; after a gap the history starts over.
+ * Once a cycle is confirmed, detectorPtr->period and detectorPtr->entryGeneration are set and further calls change nothing.
+ * Call it after every generation, e.g. through runGameUntilCycle. Returns 0 on success; > 0 on malloc failure. */
+ErrorChar observeGameCycle( CycleDetector *detectorPtr, Game *gamePtr ) {
+	ErrorChar error = 0;
+	
+	const GenerationStats *statsPtr = getGameStats( gamePtr );
+	Grid *gridPtr = gamePtr->currentGridPtr;
+	unsigned long long generation = gamePtr->generation;
+	size_t rowWords = bitboardRowWords( gridPtr );
+	size_t gridWordCount = (size_t) gridPtr->gridSizeX * rowWords + 1; // not 0 words for an empty Grid
+	uint64_t *row = NULL;
+	
+	if ( statsPtr == NULL ) {
+		error = 1;
+	} else if ( detectorPtr->period == 0 ) {
+		if ( detectorPtr->count > 0 && generation != detectorPtr->lastGeneration + 1 ) {
+			resetCycleDetector( detectorPtr );
+		}
+		if ( detectorPtr->gridWordCount != gridWordCount ) { // the first observation, or another Game
+			resetCycleDetector( detectorPtr );
+			free( detectorPtr->gridWords );
+			detectorPtr->gridWords = NULL;
+			detectorPtr->gridWordCount = 0;
+			if ( gridWordCount <= SIZE_MAX / sizeof( uint64_t ) / (size_t) detectorPtr->maxPeriod ) {
+				detectorPtr->gridWords = (uint64_t *) malloc( (size_t) detectorPtr->maxPeriod * gridWordCount * sizeof( uint64_t ) );
+			}
+			if ( detectorPtr->gridWords != NULL ) {
+				detectorPtr->gridWordCount = gridWordCount;
+			}
+		}
+		row = (uint64_t *) malloc( ( rowWords + 2 ) * sizeof( uint64_t ) );
+		if ( detectorPtr->gridWords == NULL || row == NULL ) {
+			error = 2;
+		} else {
+			for ( int period = 1; detectorPtr->period == 0 && period <= detectorPtr->count; ++period ) {
+				int index = ( detectorPtr->newest - period + 1 + detectorPtr->maxPeriod ) % detectorPtr->maxPeriod;
+				if ( detectorPtr->hashes[index] == statsPtr->hash && packOrCompareGridCells( gridPtr, detectorPtr->gridWords + (size_t) index * gridWordCount, row, true ) == true ) {
+					detectorPtr->period = period;
+					detectorPtr->entryGeneration = generation - (unsigned long long) period;
+				}
+			}
+			if ( detectorPtr->period == 0 ) {
+				detectorPtr->newest = ( detectorPtr->count == 0 ) ? 0 : ( detectorPtr->newest + 1 ) % detectorPtr->maxPeriod;
+				detectorPtr->hashes[detectorPtr->newest] = statsPtr->hash;
+				packOrCompareGridCells( gridPtr, detectorPtr->gridWords + (size_t) detectorPtr->newest * gridWordCount, row, false );
+				detectorPtr->count += ( detectorPtr->count < detectorPtr->maxPeriod ) ? 1 : 0;
+				detectorPtr->lastGeneration = generation;
+			}
+		}
+		free( row );
+	}
+	if ( error > 1 ) {
+		fprintf( stderr, "ERROR: Could not allocate memory to detect cycles of period up to %d in a grid with dimensions %lld by %lld.\n", detectorPtr->maxPeriod, gridPtr->gridSizeX, gridPtr->gridSizeY );
+	}
+	
+	return error;
+}
+
+/* Steps the Game one generation at a time, observing each one, until detectorPtr confirms a cycle or maxGenerations have passed.
+ * Generations are stepped with iterateGame, so the bitboard engines hash them in passing. Returns the number of generations stepped. */
+unsigned long long runGameUntilCycle( Game *gamePtr, CycleDetector *detectorPtr, unsigned long long maxGenerations ) {
+	unsigned long long generations = 0;
+	ErrorChar error = observeGameCycle( detectorPtr, gamePtr );
+	
+	while ( error == 0 && detectorPtr->period == 0 && generations < maxGenerations ) {
+		iterateGame( gamePtr );
+		++generations;
+		error = observeGameCycle( detectorPtr, gamePtr );
+	}
+	
+	return generations;
+}
+
+
+/* Rule */
+
+/* Parses a life-like rule in B/S notation, e.g. "B3/S23" for Conway's rule or "B36/S23" for HighLife, into the Rule pointed at by rulePtr.
+ * The letters may be lower case, the parts may come in either order and either list of neighbor counts ( 0 .. 8 ) may be empty.
+ * Returns 0 on success; > 0 on invalid notation, in which case the Rule is unchanged. */
+ErrorChar parseRule( const char *notation, Rule *rulePtr ) {
+	ErrorChar error = 0;
+	
+	uint16_t lists[2] = { 0, 0 }; // birth, survival
+	bool seen[2] = { false, false };
+	const char *c = notation;
+	
+	while ( error == 0 && *c != '\0' ) {
+		int part = ( *c == 'B' || *c == 'b' ) ? 0 : ( *c == 'S' || *c == 's' ) ? 1 : -1;
+		if ( part < 0 || seen[part] == true ) {
+			error = 1;
+		} else {
+			seen[part] = true;
+			for ( ++c; *c >= '0' && *c <= '8'; ++c ) {
+				lists[part] |= (uint16_t) ( 1 << ( *c - '0' ) );
+			}
+			if ( *c == '/' && seen[ 1 - part ] == false ) {
+				++c;
+			} else if ( *c != '\0' ) {
+				error = 1;
+			}
+		}
+	}
+	if ( error == 0 && ( seen[0] == false || seen[1] == false ) ) {
+		error = 1;
+	}
+	if ( error != 0 ) {
+		fprintf( stderr, "ERROR: Rule \"%s\" is invalid. Expected B/S notation like \"B3/S23\".\n", notation );
+	} else {
+		rulePtr->birth = lists[0];
+		rulePtr->survival = lists[1];
+		for ( int n = 0; n <= 8; ++n ) {
+			rulePtr->birthMasks[n] = ( ( lists[0] >> n ) & 1 ) ? ~0ULL : 0;
+			rulePtr->survivalMasks[n] = ( ( lists[1] >> n ) & 1 ) ? ~0ULL : 0;
+		}
+		if ( lists[0] == 0x008 && lists[1] == 0x00C ) {
+			rulePtr->family = GOL__RULE__CONWAY;
+		} else if ( lists[0] == 0x048 && lists[1] == 0x00C ) {
+			rulePtr->family = GOL__RULE__HIGHLIFE;
+		} else if ( lists[0] == 0x1C8 && lists[1] == 0x1D8 ) {
+			rulePtr->family = GOL__RULE__DAY_AND_NIGHT;
+		} else if ( lists[0] == 0x004 && lists[1] == 0x000 ) {
+			rulePtr->family = GOL__RULE__SEEDS;
+		} else {
+			rulePtr->family = GOL__RULE__GENERIC;
+		}
+	}
+	
+	return error;
+}
+
+/* Writes the rule in canonical B/S notation into notation, which must hold GOL__RULE__NOTATION_SIZE chars. */
+void formatRule( const Rule *rulePtr, char *notation ) {
+	char *c = notation;
+	
+	*c++ = 'B';
+	for ( int n = 0; n <= 8; ++n ) {
+		if ( ( rulePtr->birth >> n ) & 1 ) {
+			*c++ = (char) ( '0' + n );
+		}
+	}
+	*c++ = '/';
+	*c++ = 'S';
+	for ( int n = 0; n <= 8; ++n ) {
+		if ( ( rulePtr->survival >> n ) & 1 ) {
+			*c++ = (char) ( '0' + n );
+		}
+	}
+	*c = '\0';
+}
+
+
+/* Bitboard - packed rows */
+/* A packed row holds column y of the Grid in bit ( y % 64 ) of word ( y / 64 ).
+ * Word -1 is a ghost word whose bit 63 holds column -1, and column gridSizeY sits right after the last cell,
+ * so stepBitboardRow never needs to special-case the edges. The rows of a Grid are packed rows themselves; packGridRow and unpackGridRow
+ * copy a range of their words for the engines that work on a window of rows. */
+
+/* Returns the number of words needed for the cells of one row, excluding the ghost word on the left. Column gridSizeY always fits. */
+size_t bitboardRowWords( Grid *gridPtr ) {
+	return (size_t) ( gridPtr->gridSizeY / GOL__BITBOARD__CELLS_PER_WORD + 1 );
+}
+
+/* Copies words firstWord - 1 .. firstWord + wordCount of row x ( -1 <= x <= gridSizeX ) of the Grid into words[-1 .. wordCount].
+ * The ghost cells in columns -1 and gridSizeY are copied as they are (call fillGridHalo first); bits beyond them are 0. */
+void packGridRow( Grid *gridPtr, long long x, size_t firstWord, size_t wordCount, uint64_t *words ) {
+	const uint64_t *row = gridPtr->origin[x];
+	long long lastWord = (long long) gridPtr->arraySizeY - 1; // the word of the ghost column
+	uint64_t lastMask = ( ( 1ULL << ( gridPtr->gridSizeY % GOL__BITBOARD__CELLS_PER_WORD ) ) << 1 ) - 1; // up to and including the ghost bit
+	
+	for ( long long k = -1; k <= (long long) wordCount; ++k ) {
+		long long rowWord = (long long) firstWord + k;
+		uint64_t word = ( rowWord <= lastWord ) ? row[rowWord] : 0;
+		if ( rowWord == lastWord ) {
+			word &= lastMask;
+		} else if ( rowWord == -1 ) {
+			word &= 1ULL << 63;
+		}
+		words[k] = word;
+	}
+}
+
+/* Writes words[0 .. wordCount - 1], which hold words firstWord .. firstWord + wordCount - 1 of a packed row, back into row x of the Grid.
+ * Ghost cells are ignored. */
+void unpackGridRow( Grid *gridPtr, long long x, size_t firstWord, size_t wordCount, const uint64_t *words ) {
+	uint64_t *row = gridPtr->origin[x];
+	size_t lastWord = gridPtr->arraySizeY - 1;
+	uint64_t cellMask = ( 1ULL << ( gridPtr->gridSizeY % GOL__BITBOARD__CELLS_PER_WORD ) ) - 1; // the cells of the last word
+	size_t endWord = firstWord + wordCount;
+	
+	if ( endWord > lastWord ) {
+		endWord = lastWord;
+		if ( firstWord <= lastWord ) {
+			row[lastWord] = ( row[lastWord] & ~cellMask ) | ( words[ lastWord - firstWord ] & cellMask );
+		}
+	}
+	if ( firstWord < endWord ) {
+		memcpy( row + firstWord, words, ( endWord - firstWord ) * sizeof( uint64_t ) );
+	}
+}
+
+/* Computes words 0 .. wordCount - 1 of the next generation of mid under Conway's rule; rulePtr is not used and may be NULL.
+ * above, mid and below must be readable from word -1 to word wordCount. The eight neighbors are summed with bitwise half and full adders, 64 cells in parallel. */
+void stepBitboardRow( const uint64_t *above, const uint64_t *mid, const uint64_t *below, uint64_t *out, size_t wordCount, const Rule *rulePtr ) {
+	(void) rulePtr; // Conway's rule is built in
+	for ( size_t k = 0; k < wordCount; ++k ) {
+		/* Neighbors to the west (bit from column y - 1) and to the east (bit from column y + 1) of each row. */
+		uint64_t aW = ( above[k] << 1 ) | ( above[ k - 1 ] >> 63 );
+		uint64_t aC = above[k];
+		uint64_t aE = ( above[k] >> 1 ) | ( above[ k + 1 ] << 63 );
+		uint64_t mW = ( mid[k] << 1 ) | ( mid[ k - 1 ] >> 63 );
+		uint64_t mE = ( mid[k] >> 1 ) | ( mid[ k + 1 ] << 63 );
+		uint64_t bW = ( below[k] << 1 ) | ( below[ k - 1 ] >> 63 );
+		uint64_t bC = below[k];
+		uint64_t bE = ( below[k] >> 1 ) | ( below[ k + 1 ] << 63 );
+		
+		/* Two-bit sums of the upper three, the lower three and the two middle neighbors. */
+		uint64_t a0 = aW ^ aC ^ aE;
+		uint64_t a1 = ( aW & aC ) | ( aE & ( aW ^ aC ) );
+		uint64_t b0 = bW ^ bC ^ bE;
+		uint64_t b1 = ( bW & bC ) | ( bE & ( bW ^ bC ) );
+		uint64_t m0 = mW ^ mE;
+		uint64_t m1 = mW & mE;
+		
+		/* Add the three two-bit sums: s0 and s1 are the low bits, high is set for four or more neighbors. */
+		uint64_t s0 = a0 ^ b0 ^ m0;
+		uint64_t c0 = ( a0 & b0 ) | ( m0 & ( a0 ^ b0 ) );
+		uint64_t t = a1 ^ b1;
+		uint64_t v = m1 ^ c0;
+		uint64_t s1 = t ^ v;
+		uint64_t high = ( a1 & b1 ) | ( m1 & c0 ) | ( t & v );
+		
+		/* Alive next generation: exactly three neighbors, or exactly two neighbors and alive now. */
+		out[k] = ~high & s1 & ( s0 | mid[k] );
+	}
+}
+
+
+/* Bitboard - row kernels */
+/* Every kernel computes the same function as the portable one of its rule; the vector ones process 4 or 8 words per instruction
+ * and leave the remainder of the row to the portable one. selectRowKernel picks the instruction set, getRowKernel the rule. */
+
+static char rowKernelId = GOL__KERNEL__AUTO; // GOL__KERNEL__AUTO until the first selection
+
+#ifdef GOL__X86_KERNELS
+/* stepBitboardRow with 256-bit vectors. Requires AVX2. */
+__attribute__(( target( "avx2" ) ))
+void stepBitboardRowAvx2( const uint64_t *above, const uint64_t *mid, const uint64_t *below, uint64_t *out, size_t wordCount, const Rule *rulePtr ) {
+	size_t k = 0;
+	
+	for ( ; k + 4 <= wordCount; k += 4 ) {
+		__m256i a = _mm256_loadu_si256( (const __m256i *) ( above + k ) );
+		__m256i m = _mm256_loadu_si256( (const __m256i *) ( mid + k ) );
+		__m256i b = _mm256_loadu_si256( (const __m256i *) ( below + k ) );
+		
+		/* Neighbors to the west and to the east; the words one to the left and one to the right provide the carried bits. */
+		__m256i aW = _mm256_or_si256( _mm256_slli_epi64( a, 1 ), _mm256_srli_epi64( _mm256_loadu_si256( (const __m256i *) ( above + k - 1 ) ), 63 ) );
+		__m256i aE = _mm256_or_si256( _mm256_srli_epi64( a, 1 ), _mm256_slli_epi64( _mm256_loadu_si256( (const __m256i *) ( above + k + 1 ) ), 63 ) );
+		__m256i mW = _mm256_or_si256( _mm256_slli_epi64( m, 1 ), _mm256_srli_epi64( _mm256_loadu_si256( (const __m256i *) ( mid + k - 1 ) ), 63 ) );
+		__m256i mE = _mm256_or_si256( _mm256_srli_epi64( m, 1 ), _mm256_slli_epi64( _mm256_loadu_si256( (const __m256i *) ( mid + k + 1 ) ), 63 ) );
+		__m256i bW = _mm256_or_si256( _mm256_slli_epi64( b, 1 ), _mm256_srli_epi64( _mm256_loadu_si256( (const __m256i *) ( below + k - 1 ) ), 63 ) );
+		__m256i bE = _mm256_or_si256( _mm256_srli_epi64( b, 1 ), _mm256_slli_epi64( _mm256_loadu_si256( (const __m256i *) ( below + k + 1 ) ), 63 ) );
+		
+		__m256i aX = _mm256_xor_si256( aW, a );
+		__m256i a0 = _mm256_xor_si256( aX, aE );
+		__m256i a1 = _mm256_or_si256( _mm256_and_si256( aW, a ), _mm256_and_si256( aE, aX ) );
+		__m256i bX = _mm256_xor_si256( bW, b );
+		__m256i b0 = _mm256_xor_si256( bX, bE );
+		__m256i b1 = _mm256_or_si256( _mm256_and_si256( bW, b ), _mm256_and_si256( bE, bX ) );
+		__m256i m0 = _mm256_xor_si256( mW, mE );
+		__m256i m1 = _mm256_and_si256( mW, mE );
+		
+		__m256i abX = _mm256_xor_si256( a0, b0 );
+		__m256i s0 = _mm256_xor_si256( abX, m0 );
+		__m256i c0 = _mm256_or_si256( _mm256_and_si256( a0, b0 ), _mm256_and_si256( m0, abX ) );
+		__m256i t = _mm256_xor_si256( a1, b1 );
+		__m256i v = _mm256_xor_si256( m1, c0 );
+		__m256i s1 = _mm256_xor_si256( t, v );
+		__m256i high = _mm256_or_si256( _mm256_or_si256( _mm256_and_si256( a1, b1 ), _mm256_and_si256( m1, c0 ) ), _mm256_and_si256( t, v ) );
+		
+		_mm256_storeu_si256( (__m256i *) ( out + k ), _mm256_andnot_si256( high, _mm256_and_si256( s1, _mm256_or_si256( s0, m ) ) ) );
+	}
+	stepBitboardRow( above + k, mid + k, below + k, out + k, wordCount - k, rulePtr );
+}
+
+/* stepBitboardRow with 512-bit vectors; ternary logic folds the three-input XORs and majorities into one instruction each. Requires AVX-512F. */
+__attribute__(( target( "avx512f" ) ))
+void stepBitboardRowAvx512( const uint64_t *above, const uint64_t *mid, const uint64_t *below, uint64_t *out, size_t wordCount, const Rule *rulePtr ) {
+	size_t k = 0;
+	
+	for ( ; k + 8 <= wordCount; k += 8 ) {
+		__m512i a = _mm512_loadu_si512( above + k );
+		__m512i m = _mm512_loadu_si512( mid + k );
+		__m512i b = _mm512_loadu_si512( below + k );
+		
+		__m512i aW = _mm512_or_si512( _mm512_slli_epi64( a, 1 ), _mm512_srli_epi64( _mm512_loadu_si512( above + k - 1 ), 63 ) );
+		__m512i aE = _mm512_or_si512( _mm512_srli_epi64( a, 1 ), _mm512_slli_epi64( _mm512_loadu_si512( above + k + 1 ), 63 ) );
+		__m512i mW = _mm512_or_si512( _mm512_slli_epi64( m, 1 ), _mm512_srli_epi64( _mm512_loadu_si512( mid + k - 1 ), 63 ) );
+		__m512i mE = _mm512_or_si512( _mm512_srli_epi64( m, 1 ), _mm512_slli_epi64( _mm512_loadu_si512( mid + k + 1 ), 63 ) );
+		__m512i bW = _mm512_or_si512( _mm512_slli_epi64( b, 1 ), _mm512_srli_epi64( _mm512_loadu_si512( below + k - 1 ), 63 ) );
+		__m512i bE = _mm512_or_si512( _mm512_srli_epi64( b, 1 ), _mm512_slli_epi64( _mm512_loadu_si512( below + k + 1 ), 63 ) );
+		
+		/* 0x96 is the truth table of x ^ y ^ z, 0xE8 the one of the majority of x, y and z. */
+		__m512i a0 = _mm512_ternarylogic_epi64( aW, a, aE, 0x96 );
+		__m512i a1 = _mm512_ternarylogic_epi64( aW, a, aE, 0xE8 );
+		__m512i b0 = _mm512_ternarylogic_epi64( bW, b, bE, 0x96 );
+		__m512i b1 = _mm512_ternarylogic_epi64( bW, b, bE, 0xE8 );
+		__m512i m0 = _mm512_xor_si512( mW, mE );
+		__m512i m1 = _mm512_and_si512( mW, mE );
+		
+		__m512i s0 = _mm512_ternarylogic_epi64( a0, b0, m0, 0x96 );
+		__m512i c0 = _mm512_ternarylogic_epi64( a0, b0, m0, 0xE8 );
+		__m512i v = _mm512_xor_si512( m1, c0 );
+		__m512i s1 = _mm512_ternarylogic_epi64( a1, b1, v, 0x96 );
+		/* Four or more neighbors: at least two of a1, b1, m1 and c0. */
+		__m512i high = _mm512_or_si512( _mm512_ternarylogic_epi64( a1, b1, v, 0xE8 ), _mm512_and_si512( m1, c0 ) );
+		
+		_mm512_storeu_si512( out + k, _mm512_andnot_si512( high, _mm512_and_si512( s1, _mm512_or_si512( s0, m ) ) ) );
+	}
+	stepBitboardRow( above + k, mid + k, below + k, out + k, wordCount - k, rulePtr );
+}
+#endif
+
+/* The kernels of the other rules are generated from one template per instruction set. GOL__ROW_KERNEL_LOOP steps words k, k + LANES, ...
+ * of the row with Word, a uint64_t or a vector of them, and sums the neighbors into the four bit planes of a count from 0 to 8:
+ * s0, s1, s2 hold the low three bits, s3 is set for eight neighbors only (and the other planes are clear then).
+ * NEXT is the rule as a bitwise expression of m ( the cells themselves ) and these planes, so no rule is evaluated per cell. */
+#define GOL__ROW_KERNEL_LOOP( Word, LANES, NEXT ) \
+	for ( ; k + LANES <= wordCount; k += LANES ) { \
+		Word a, aL, aR, m, mL, mR, b, bL, bR; \
+		memcpy( &a, above + k, sizeof( Word ) ); memcpy( &aL, above + k - 1, sizeof( Word ) ); memcpy( &aR, above + k + 1, sizeof( Word ) ); \
+		memcpy( &m, mid + k, sizeof( Word ) ); memcpy( &mL, mid + k - 1, sizeof( Word ) ); memcpy( &mR, mid + k + 1, sizeof( Word ) ); \
+		memcpy( &b, below + k, sizeof( Word ) ); memcpy( &bL, below + k - 1, sizeof( Word ) ); memcpy( &bR, below + k + 1, sizeof( Word ) ); \
+		Word aW = ( a << 1 ) | ( aL >> 63 ); \
+		Word aE = ( a >> 1 ) | ( aR << 63 ); \
+		Word mW = ( m << 1 ) | ( mL >> 63 ); \
+		Word mE = ( m >> 1 ) | ( mR << 63 ); \
+		Word bW = ( b << 1 ) | ( bL >> 63 ); \
+		Word bE = ( b >> 1 ) | ( bR << 63 ); \
+		GOL__SUM_NEIGHBORS( Word, aW, a, aE, mW, mE, bW, b, bE ) \
+		Word next = ( NEXT ); \
+		memcpy( out + k, &next, sizeof( Word ) ); \
+	}
+
+/* Declares the bit planes s0 .. s3 of the number of set neighbors among the eight given words, with bitwise half and full adders. */
+#define GOL__SUM_NEIGHBORS( Word, aW, aC, aE, mW, mE, bW, bC, bE ) \
+	Word a0 = aW ^ aC ^ aE; \
+	Word a1 = ( aW & aC ) | ( aE & ( aW ^ aC ) ); \
+	Word b0 = bW ^ bC ^ bE; \
+	Word b1 = ( bW & bC ) | ( bE & ( bW ^ bC ) ); \
+	Word m0 = mW ^ mE; \
+	Word m1 = mW & mE; \
+	Word s0 = a0 ^ b0 ^ m0; \
+	Word c0 = ( a0 & b0 ) | ( m0 & ( a0 ^ b0 ) ); \
+	Word t = a1 ^ b1; \
+	Word v = m1 ^ c0; \
+	Word s1 = t ^ v; \
+	Word s2 = ( a1 & b1 ) ^ ( m1 & c0 ) ^ ( t & v ); \
+	Word s3 = a1 & b1 & m1 & c0; \
+	(void) s3;
+
+/* Defines the portable kernel name and, with GOL__X86_KERNELS, nameAvx2 and nameAvx512 for one rule. */
+#ifdef GOL__X86_KERNELS
+typedef uint64_t GolWords256 __attribute__(( vector_size( 32 ) ));
+typedef uint64_t GolWords512 __attribute__(( vector_size( 64 ) ));
+#define GOL__DEFINE_RULE_KERNELS( name, NEXT ) \
+	GOL__DEFINE_PORTABLE_RULE_KERNEL( name, NEXT ) \
+	__attribute__(( target( "avx2" ) )) \
+	void name##Avx2( const uint64_t *above, const uint64_t *mid, const uint64_t *below, uint64_t *out, size_t wordCount, const Rule *rulePtr ) { \
+		size_t k = 0; \
+		GOL__ROW_KERNEL_LOOP( GolWords256, 4, NEXT ) \
+		name( above + k, mid + k, below + k, out + k, wordCount - k, rulePtr ); \
+	} \
+	__attribute__(( target( "avx512f" ) )) \
+	void name##Avx512( const uint64_t *above, const uint64_t *mid, const uint64_t *below, uint64_t *out, size_t wordCount, const Rule *rulePtr ) { \
+		size_t k = 0; \
+		GOL__ROW_KERNEL_LOOP( GolWords512, 8, NEXT ) \
+		name( above + k, mid + k, below + k, out + k, wordCount - k, rulePtr ); \
+	}
+#define GOL__RULE_KERNELS( name ) { name, name, name##Avx2, name##Avx512 }
+#else
+#define GOL__DEFINE_RULE_KERNELS( name, NEXT ) GOL__DEFINE_PORTABLE_RULE_KERNEL( name, NEXT )
+#define GOL__RULE_KERNELS( name ) { name, name, name, name }
+#endif
+#define GOL__DEFINE_PORTABLE_RULE_KERNEL( name, NEXT ) \
+	void name( const uint64_t *above, const uint64_t *mid, const uint64_t *below, uint64_t *out, size_t wordCount, const Rule *rulePtr ) { \
+		size_t k = 0; \
+		(void) rulePtr; \
+		GOL__ROW_KERNEL_LOOP( uint64_t, 1, NEXT ) \
+	}
+
+/* Exactly n neighbors, for n from 0 to 8. */
+#define GOL__NEIGHBORS_0 ~( s3 | s2 | s1 | s0 )
+#define GOL__NEIGHBORS_1 ( ~s2 & ~s1 & s0 )
+#define GOL__NEIGHBORS_2 ( ~s2 & s1 & ~s0 )
+#define GOL__NEIGHBORS_3 ( ~s2 & s1 & s0 )
+#define GOL__NEIGHBORS_4 ( s2 & ~s1 & ~s0 )
+#define GOL__NEIGHBORS_5 ( s2 & ~s1 & s0 )
+#define GOL__NEIGHBORS_6 ( s2 & s1 & ~s0 )
+#define GOL__NEIGHBORS_7 ( s2 & s1 & s0 )
+#define GOL__NEIGHBORS_8 s3
+/* The generic rule: for every count, the cells with that count take the survival mask if alive and the birth mask if dead. */
+#define GOL__GENERIC_TERM( n ) ( GOL__NEIGHBORS_##n & ( ( m & rulePtr->survivalMasks[n] ) | ( ~m & rulePtr->birthMasks[n] ) ) )
+
+GOL__DEFINE_RULE_KERNELS( stepBitboardRowHighLife, ( ~s2 & s1 & ( s0 | m ) ) | ( ~m & GOL__NEIGHBORS_6 ) )
+GOL__DEFINE_RULE_KERNELS( stepBitboardRowDayAndNight, GOL__NEIGHBORS_3 | ( s2 & s1 ) | s3 | ( m & GOL__NEIGHBORS_4 ) )
+GOL__DEFINE_RULE_KERNELS( stepBitboardRowSeeds, ~m & GOL__NEIGHBORS_2 )
+GOL__DEFINE_RULE_KERNELS( stepBitboardRowGeneric, GOL__GENERIC_TERM( 0 ) | GOL__GENERIC_TERM( 1 ) | GOL__GENERIC_TERM( 2 ) |
+	GOL__GENERIC_TERM( 3 ) | GOL__GENERIC_TERM( 4 ) | GOL__GENERIC_TERM( 5 ) | GOL__GENERIC_TERM( 6 ) | GOL__GENERIC_TERM( 7 ) | GOL__GENERIC_TERM( 8 ) )
+
+/* The kernels by rule family and by GOL__KERNEL__* ( GOL__KERNEL__AUTO is never looked up ). */
+#ifdef GOL__X86_KERNELS
+static const RowKernel ruleRowKernels[ GOL__RULE__GENERIC + 1 ][4] = {
+	{ stepBitboardRow, stepBitboardRow, stepBitboardRowAvx2, stepBitboardRowAvx512 },
+#else
+static const RowKernel ruleRowKernels[ GOL__RULE__GENERIC + 1 ][4] = {
+	{ stepBitboardRow, stepBitboardRow, stepBitboardRow, stepBitboardRow },
+#endif
+	GOL__RULE_KERNELS( stepBitboardRowHighLife ),
+	GOL__RULE_KERNELS( stepBitboardRowDayAndNight ),
+	GOL__RULE_KERNELS( stepBitboardRowSeeds ),
+	GOL__RULE_KERNELS( stepBitboardRowGeneric )
+};
+
+/* Returns true, if this build and this CPU can run the row kernel. GOL__KERNEL__AUTO and GOL__KERNEL__PORTABLE are always supported. */
+bool rowKernelSupported( char kernel ) {
+	bool supported = false;
+	
+	switch ( kernel ) {
+		case GOL__KERNEL__AUTO:
+		case GOL__KERNEL__PORTABLE:
+			supported = true;
+			break;
+#ifdef GOL__X86_KERNELS
+		case GOL__KERNEL__AVX2:
+			__builtin_cpu_init();
+			supported = __builtin_cpu_supports( "avx2" );
+			break;
+		case GOL__KERNEL__AVX512:
+			__builtin_cpu_init();
+			supported = __builtin_cpu_supports( "avx512f" );
+			break;
+#endif
+		default:
+			break;
+	}
+	
+	return supported;
+}
+
+/* Selects the row kernel used by the bitboard engine. GOL__KERNEL__AUTO picks the widest one the CPU supports (cpuid).
+ * Call it before stepping Games on several threads. Returns 0 on success; > 0 if the kernel is invalid or unsupported, in which case nothing changes. */
+ErrorChar selectRowKernel( char kernel ) {
+	ErrorChar error = 0;
+	
+	if ( rowKernelSupported( kernel ) == false ) {
+		error = 1;
+		fprintf( stderr, "ERROR: kernel == %d is invalid or not supported by this CPU.\n", kernel );
+	} else {
+		if ( kernel == GOL__KERNEL__AUTO ) {
+			if ( rowKernelSupported( GOL__KERNEL__AVX512 ) ) {
+				kernel = GOL__KERNEL__AVX512;
+			} else if ( rowKernelSupported( GOL__KERNEL__AVX2 ) ) {
+				kernel = GOL__KERNEL__AVX2;
+			} else {
+				kernel = GOL__KERNEL__PORTABLE;
+			}
+		}
+		rowKernelId = kernel;
+	}
+	
+	return error;
+}
+
+/* Returns the row kernel in use: GOL__KERNEL__PORTABLE, GOL__KERNEL__AVX2 or GOL__KERNEL__AVX512. */
+char activeRowKernel() {
+	if ( rowKernelId == GOL__KERNEL__AUTO ) {
+		selectRowKernel( GOL__KERNEL__AUTO );
+	}
+	return rowKernelId;
+}
+
+/* Returns a printable name of the row kernel, e.g. for attributing benchmark results. */
+const char *rowKernelName( char kernel ) {
+	const char *name;
+	
+	switch ( kernel ) {
+		case GOL__KERNEL__AUTO:
+			name = "auto";
+			break;
+		case GOL__KERNEL__PORTABLE:
+			name = "portable";
+			break;
+		case GOL__KERNEL__AVX2:
+			name = "avx2";
+			break;
+		case GOL__KERNEL__AVX512:
+			name = "avx512";
+			break;
+		default:
+			name = "invalid";
+			break;
+	}
+	
+	return name;
+}
+
+/* Defines name, which adds row x of a generation to the GenerationStats pointed at by statsPtr: the live cells of after, the cells that differ
+ * from before, the extent of the live cells and, for a row with any, a hash of its words and x. Reads words 0 .. rowWords - 1 of both;
+ * lastMask keeps the cells of the last word, since bits from column gridSizeY on are ghost cells or left over from the kernel. */
+#define GOL__DEFINE_ROW_STATS( name ) \
+	void name( GenerationStats *statsPtr, long long x, const uint64_t *before, const uint64_t *after, size_t rowWords, uint64_t lastMask ) { \
+		unsigned long long population = 0; \
+		unsigned long long changed = 0; \
+		size_t lastWord = rowWords - 1; \
+		uint64_t lastLive = after[lastWord] & lastMask; \
+		\
+		for ( size_t k = 0; k < lastWord; ++k ) { \
+			population += (unsigned long long) __builtin_popcountll( after[k] ); \
+			changed += (unsigned long long) __builtin_popcountll( after[k] ^ before[k] ); \
+		} \
+		population += (unsigned long long) __builtin_popcountll( lastLive ); \
+		changed += (unsigned long long) __builtin_popcountll( ( after[lastWord] ^ before[lastWord] ) & lastMask ); \
+		statsPtr->population += population; \
+		statsPtr->changed += changed; \
+		if ( population > 0 ) { \
+			uint64_t hash = ( lastLive + lastWord * 0x9E3779B97F4A7C15ULL ) * 0xBF58476D1CE4E5B9ULL; \
+			for ( size_t k = 0; k < lastWord; ++k ) { /* independent products, so that the loop is not one long chain of multiplications */ \
+				uint64_t product = ( after[k] + k * 0x9E3779B97F4A7C15ULL ) * 0xBF58476D1CE4E5B9ULL; \
+				hash += product ^ ( product >> 32 ); \
+			} \
+			hash = ( hash ^ ( hash >> 31 ) ^ (uint64_t) x ) * 0x94D049BB133111EBULL; \
+			statsPtr->hash += hash ^ ( hash >> 29 ); \
+			size_t first = 0; \
+			size_t last = lastWord; \
+			while ( after[first] == 0 ) { /* a live cell stops it by the last word */ \
+				++first; \
+			} \
+			while ( ( ( last == lastWord ) ? lastLive : after[last] ) == 0 ) { \
+				--last; \
+			} \
+			long long minY = (long long) ( first * GOL__BITBOARD__CELLS_PER_WORD ) + __builtin_ctzll( after[first] ); \
+			long long maxY = (long long) ( last * GOL__BITBOARD__CELLS_PER_WORD ) + 63 - __builtin_clzll( ( last == lastWord ) ? lastLive : after[last] ); \
+			statsPtr->minX = ( x < statsPtr->minX ) ? x : statsPtr->minX; \
+			statsPtr->maxX = ( x > statsPtr->maxX ) ? x : statsPtr->maxX; \
+			statsPtr->minY = ( minY < statsPtr->minY ) ? minY : statsPtr->minY; \
+			statsPtr->maxY = ( maxY > statsPtr->maxY ) ? maxY : statsPtr->maxY; \
+		} \
+	}
+
+GOL__DEFINE_ROW_STATS( addPackedRowStats )
+#ifdef GOL__X86_KERNELS
+/* addPackedRowStats with the POPCNT instruction, which every CPU with AVX2 has. */
+__attribute__(( target( "popcnt" ) ))
+GOL__DEFINE_ROW_STATS( addPackedRowStatsPopcnt )
+#endif
+
+/* Returns the row kernel for the rule with the selected instruction set, selecting the best one on first use. */
+RowKernel getRowKernel( const Rule *rulePtr ) {
+	return ruleRowKernels[ (int) rulePtr->family ][ (int) activeRowKernel() ];
+}
+
+/* Returns the function that adds a packed row to GenerationStats: the one with hardware popcount along with the vector kernels. */
+RowStatsFunction getRowStatsFunction() {
+	RowStatsFunction rowStats = addPackedRowStats;
+#ifdef GOL__X86_KERNELS
+	if ( activeRowKernel() != GOL__KERNEL__PORTABLE ) {
+		rowStats = addPackedRowStatsPopcnt;
+	}
+#endif
+	return rowStats;
+}
+
+
+/* HashLife - create & destroy */
+/* Every node is canonical: joinHashLifeNodes returns the existing node for four given quadrants, so equal squares are the same pointer
+ * and their futures are computed once. Nodes live in blocks of 4096 and are recycled through a free list by collectHashLifeGarbage. */
+
+/* Creates an empty HashLife universe. Returns a pointer to it, if successful. Returns a NULL pointer otherwise. */
+HashLife *createHashLife() {
+	bool error = false;
+	
+	HashLife *newUniversePtr = (HashLife *) calloc( 1, sizeof( HashLife ) );
+	
+	if ( newUniversePtr == NULL ) {
+		error = true;
+	} else {
+		newUniversePtr->bucketCount = 1 << 16;
+		newUniversePtr->buckets = (HashLifeNode **) calloc( newUniversePtr->bucketCount, sizeof( HashLifeNode * ) );
+		if ( newUniversePtr->buckets == NULL ) {
+			error = true;
+			free( newUniversePtr );
+			newUniversePtr = NULL;
+		} else {
+			newUniversePtr->deadCell.resultLog = -1;
+			newUniversePtr->liveCell.resultLog = -1;
+			newUniversePtr->liveCell.population = 1;
+			newUniversePtr->empty[0] = &(newUniversePtr->deadCell);
+			newUniversePtr->nodeLimit = GOL__HASHLIFE__NODE_LIMIT;
+			newUniversePtr->root = emptyHashLifeNode( newUniversePtr, 3 );
+			if ( newUniversePtr->root == NULL ) {
+				error = true;
+				destroyHashLife( newUniversePtr );
+				newUniversePtr = NULL;
+			}
+		}
+	}
+	if ( error == true ) {
+		fprintf( stderr, "ERROR: Could not allocate memory to create a HashLife universe.\n" );
+	}
+	
+	return newUniversePtr;
+}
+
+/* Destroys the HashLife universe pointed at by oldUniversePtr. Frees the memory. */
+void destroyHashLife( HashLife *oldUniversePtr ) {
+	HashLifeNodeBlock *blockPtr = oldUniversePtr->blocks;
+	
+	while ( blockPtr != NULL ) {
+		HashLifeNodeBlock *nextBlockPtr = blockPtr->next;
+		free( blockPtr );
+		blockPtr = nextBlockPtr;
+	}
+	free( oldUniversePtr->buckets );
+	free( oldUniversePtr );
+}
+
+
+/* HashLife - import & export */
+
+/* Builds the node of the given level whose north-west corner is cell ( x, y ) of the Grid. Cells outside the Grid are dead. */
+static HashLifeNode *buildHashLifeNode( HashLife *universePtr, Grid *gridPtr, long long x, long long y, int level ) {
+	HashLifeNode *node;
+	long long side = 1LL << level;
+	
+	if ( x >= gridPtr->gridSizeX || y >= gridPtr->gridSizeY || x + side <= 0 || y + side <= 0 ) {
+		node = emptyHashLifeNode( universePtr, level );
+	} else if ( level == 0 ) {
+		node = ( x >= 0 && y >= 0 && getCell( gridPtr, x, y ) == GOL__CELL_STATE__ON ) ? &(universePtr->liveCell) : &(universePtr->deadCell);
+	} else {
+		long long half = side / 2;
+		HashLifeNode *nw = buildHashLifeNode( universePtr, gridPtr, x, y, level - 1 );
+		HashLifeNode *ne = buildHashLifeNode( universePtr, gridPtr, x, y + half, level - 1 );
+		HashLifeNode *sw = buildHashLifeNode( universePtr, gridPtr, x + half, y, level - 1 );
+		HashLifeNode *se = buildHashLifeNode( universePtr, gridPtr, x + half, y + half, level - 1 );
+		node = ( nw == NULL || ne == NULL || sw == NULL || se == NULL ) ? NULL : joinHashLifeNodes( universePtr, nw, ne, sw, se );
+	}
+	
+	return node;
+}
+
+/* Replaces the contents of the universe with the current Grid of the Game; cell ( x, y ) of the Grid becomes cell ( x, y ) of the plane.
+ * The generation count restarts at 0. Returns 0 on success; > 0 on error (a Game whose rule is not Conway's, too large Grid or malloc failure),
+ * in which case the universe is unchanged. */
+ErrorChar importGameIntoHashLife( HashLife *universePtr, Game *gamePtr ) {
+	ErrorChar error = 0;
+	
+	Grid *gridPtr = gamePtr->currentGridPtr;
+	long long extent = ( gridPtr->gridSizeX > gridPtr->gridSizeY ) ? gridPtr->gridSizeX : gridPtr->gridSizeY;
+	int level = 3;
+	
+	while ( level < GOL__HASHLIFE__MAX_LEVEL && ( 1LL << ( level - 1 ) ) < extent ) {
+		++level;
+	}
+	if ( gamePtr->rule.family != GOL__RULE__CONWAY ) {
+		error = 3;
+		fprintf( stderr, "ERROR: HashLife only runs Conway's rule (B3/S23).\n" );
+	} else if ( ( 1LL << ( level - 1 ) ) < extent ) {
+		error = 1;
+		fprintf( stderr, "ERROR: A grid with dimensions %lld by %lld is too large for HashLife.\n", gridPtr->gridSizeX, gridPtr->gridSizeY );
+	} else {
+		/* The root covers [ -half, half ), so the Grid goes into the south-east quadrant. */
+		long long half = 1LL << ( level - 1 );
+		HashLifeNode *root = buildHashLifeNode( universePtr, gridPtr, -half, -half, level );
+		if ( root == NULL ) {
+			error = 2;
+		} else {
+			universePtr->root = root;
+			universePtr->generation = 0;
+		}
+	}
+	
+	return error;
+}
+
+/* Writes the live cells of node, whose north-west corner is cell ( x, y ), into the Grid. Cells outside the Grid are dropped. */
+static void writeHashLifeNode( HashLifeNode *node, Grid *gridPtr, long long x, long long y ) {
+	long long side = 1LL << node->level;
+	
+	if ( node->population == 0 || x >= gridPtr->gridSizeX || y >= gridPtr->gridSizeY || x + side <= 0 || y + side <= 0 ) {
+		// nothing to write
+	} else if ( node->level == 0 ) {
+		setCell( gridPtr, x, y, GOL__CELL_STATE__ON );
+	} else {
+		long long half = side / 2;
+		writeHashLifeNode( node->nw, gridPtr, x, y );
+		writeHashLifeNode( node->ne, gridPtr, x, y + half );
+		writeHashLifeNode( node->sw, gridPtr, x + half, y );
+		writeHashLifeNode( node->se, gridPtr, x + half, y + half );
+	}
+}
+
+/* Overwrites the current Grid of the Game with the part of the plane from ( 0, 0 ) to ( gridSizeX - 1, gridSizeY - 1 ). */
+void exportHashLifeToGame( HashLife *universePtr, Game *gamePtr ) {
+	Grid *gridPtr = gamePtr->currentGridPtr;
+	long long half = 1LL << ( universePtr->root->level - 1 );
+	
+	finishGameSnapshot( gamePtr );
+	for ( size_t i = 0; i < gridPtr->arraySizeX; ++i ) {
+		memset( gridPtr->origin[i], 0, gridPtr->arraySizeY * sizeof( uint64_t ) );
+	}
+	writeHashLifeNode( universePtr->root, gridPtr, -half, -half );
+	invalidateGameActivity( gamePtr );
+}
+
+
+/* HashLife - stepping */
+
+/* Returns the root one level up, with the old root in its centre, or NULL on malloc failure. */
+static HashLifeNode *expandHashLifeRoot( HashLife *universePtr ) {
+	HashLifeNode *root = universePtr->root;
+	HashLifeNode *empty = emptyHashLifeNode( universePtr, root->level - 1 );
+	HashLifeNode *expanded = NULL;
+	
+	if ( empty != NULL ) {
+		HashLifeNode *nw = joinHashLifeNodes( universePtr, empty, empty, empty, root->nw );
+		HashLifeNode *ne = joinHashLifeNodes( universePtr, empty, empty, root->ne, empty );
+		HashLifeNode *sw = joinHashLifeNodes( universePtr, empty, root->sw, empty, empty );
+		HashLifeNode *se = joinHashLifeNodes( universePtr, root->se, empty, empty, empty );
+		if ( nw != NULL && ne != NULL && sw != NULL && se != NULL ) {
+			expanded = joinHashLifeNodes( universePtr, nw, ne, sw, se );
+		}
+	}
+	
+	return expanded;
+}
+
+/* Returns the population of the centre of the centre of node ( level >= 2 ). */
+static unsigned long long innerHashLifePopulation( HashLifeNode *node ) {
+	return node->nw->se->se->population + node->ne->sw->sw->population + node->sw->ne->ne->population + node->se->nw->nw->population;
+}
+
+/* Advances the universe by 2^log2Generations generations.
+ * The root is first padded with empty space until it is large enough for the step and the pattern can not reach its border.
+ * Returns 0 on success; > 0 on error (invalid log2Generations or malloc failure), in which case the universe is unchanged. */
+ErrorChar advanceHashLife( HashLife *universePtr, int log2Generations ) {
+	ErrorChar error = 0;
+	
+	if ( log2Generations < 0 || log2Generations > GOL__HASHLIFE__MAX_LEVEL - 3 ) {
+		error = 1;
+		fprintf( stderr, "ERROR: log2Generations == %d is invalid. Valid values are only 0 to %d.\n", log2Generations, GOL__HASHLIFE__MAX_LEVEL - 3 );
+	} else {
+		if ( universePtr->nodeCount > universePtr->nodeLimit ) {
+			collectHashLifeGarbage( universePtr );
+		}
+		HashLifeNode *oldRoot = universePtr->root;
+		while ( error == 0 && ( universePtr->root->level < log2Generations + 3 || innerHashLifePopulation( universePtr->root ) != universePtr->root->population ) ) {
+			HashLifeNode *expanded = NULL;
+			if ( universePtr->root->level < GOL__HASHLIFE__MAX_LEVEL ) {
+				expanded = expandHashLifeRoot( universePtr );
+			}
+			if ( expanded == NULL ) {
+				error = 2;
+			} else {
+				universePtr->root = expanded;
+			}
+		}
+		/* The pattern now lies in the inner quarter and can spread by at most 2^log2Generations <= an eighth of the root. */
+		HashLifeNode *result = ( error == 0 ) ? advanceHashLifeNode( universePtr, universePtr->root, log2Generations ) : NULL;
+		if ( result == NULL ) {
+			error = 2;
+			universePtr->root = oldRoot;
+			fprintf( stderr, "ERROR: Could not allocate memory to advance the HashLife universe.\n" );
+		} else {
+			universePtr->root = result;
+			universePtr->generation += 1ULL << log2Generations;
+		}
+	}
+	
+	return error;
+}
+
+/* Advances the universe by any number of generations, as a sum of powers of two. Returns 0 on success; > 0 on error. */
+ErrorChar stepHashLife( HashLife *universePtr, unsigned long long generations ) {
+	ErrorChar error = 0;
+	
+	for ( int bit = 0; error == 0 && bit < 64 && ( generations >> bit ) != 0; ++bit ) {
+		if ( ( generations >> bit ) & 1 ) {
+			error = advanceHashLife( universePtr, bit );
+		}
+	}
+	
+	return error;
+}
+
+/* Returns the number of live cells in the universe. */
+unsigned long long hashLifePopulation( HashLife *universePtr ) {
+	return universePtr->root->population;
+}
+
+/* Marks node and everything below it as reachable. */
+static void markHashLifeNode( HashLifeNode *node ) {
+	if ( node != NULL && node->marked == false && node->level > 0 ) {
+		node->marked = true;
+		markHashLifeNode( node->nw );
+		markHashLifeNode( node->ne );
+		markHashLifeNode( node->sw );
+		markHashLifeNode( node->se );
+	}
+}
+
+/* Frees all nodes that are not part of the current root or the empty nodes. The memoized results of the survivors are dropped,
+ * as they might point to freed nodes. */
+void collectHashLifeGarbage( HashLife *universePtr ) {
+	markHashLifeNode( universePtr->root );
+	for ( int level = 1; level <= GOL__HASHLIFE__MAX_LEVEL; ++level ) {
+		markHashLifeNode( universePtr->empty[level] );
+	}
+	for ( size_t b = 0; b < universePtr->bucketCount; ++b ) {
+		HashLifeNode **linkPtr = &(universePtr->buckets[b]);
+		while ( *linkPtr != NULL ) {
+			HashLifeNode *node = *linkPtr;
+			if ( node->marked == true ) {
+				node->marked = false;
+				node->result = NULL;
+				node->resultLog = -1;
+				linkPtr = &(node->next);
+			} else {
+				*linkPtr = node->next;
+				node->next = universePtr->freeNodes;
+				universePtr->freeNodes = node;
+				--universePtr->nodeCount;
+			}
+		}
+	}
+}
+
+
+/* HashLife - nodes */
+
+/* Returns the canonical node with the four given quadrants (all of the same level), creating it if necessary. Returns NULL on malloc failure. */
+HashLifeNode *joinHashLifeNodes( HashLife *universePtr, HashLifeNode *nw, HashLifeNode *ne, HashLifeNode *sw, HashLifeNode *se ) {
+	uint64_t hash = (uint64_t) (uintptr_t) nw * 0x9E3779B97F4A7C15ULL + (uint64_t) (uintptr_t) ne * 0xC2B2AE3D27D4EB4FULL +
+		(uint64_t) (uintptr_t) sw * 0x165667B19E3779F9ULL + (uint64_t) (uintptr_t) se * 0xD6E8FEB86659FD93ULL;
+	hash ^= hash >> 29;
+	
+	HashLifeNode *node = universePtr->buckets[ hash & ( universePtr->bucketCount - 1 ) ];
+	while ( node != NULL && ( node->nw != nw || node->ne != ne || node->sw != sw || node->se != se ) ) {
+		node = node->next;
+	}
+	if ( node == NULL ) {
+		/* Grow the table at load factor 1; a failed resize just leaves the chains longer. */
+		if ( universePtr->nodeCount >= universePtr->bucketCount ) {
+			size_t newBucketCount = universePtr->bucketCount * 2;
+			HashLifeNode **newBuckets = (HashLifeNode **) calloc( newBucketCount, sizeof( HashLifeNode * ) );
+			if ( newBuckets != NULL ) {
+				for ( size_t b = 0; b < universePtr->bucketCount; ++b ) {
+					HashLifeNode *moving = universePtr->buckets[b];
+					while ( moving != NULL ) {
+						HashLifeNode *nextMoving = moving->next;
+						uint64_t movingHash = (uint64_t) (uintptr_t) moving->nw * 0x9E3779B97F4A7C15ULL + (uint64_t) (uintptr_t) moving->ne * 0xC2B2AE3D27D4EB4FULL +
+							(uint64_t) (uintptr_t) moving->sw * 0x165667B19E3779F9ULL + (uint64_t) (uintptr_t) moving->se * 0xD6E8FEB86659FD93ULL;
+						movingHash ^= movingHash >> 29;
+						moving->next = newBuckets[ movingHash & ( newBucketCount - 1 ) ];
+						newBuckets[ movingHash & ( newBucketCount - 1 ) ] = moving;
+						moving = nextMoving;
+					}
+				}
+				free( universePtr->buckets );
+				universePtr->buckets = newBuckets;
+				universePtr->bucketCount = newBucketCount;
+			}
+		}
+		if ( universePtr->freeNodes == NULL ) {
+			HashLifeNodeBlock *blockPtr = (HashLifeNodeBlock *) malloc( sizeof( HashLifeNodeBlock ) );
+			if ( blockPtr != NULL ) {
+				blockPtr->next = universePtr->blocks;
+				universePtr->blocks = blockPtr;
+				for ( size_t i = 0; i < sizeof( blockPtr->nodes ) / sizeof( blockPtr->nodes[0] ); ++i ) {
+					blockPtr->nodes[i].next = universePtr->freeNodes;
+					universePtr->freeNodes = &(blockPtr->nodes[i]);
+				}
+			}
+		}
+		node = universePtr->freeNodes;
+		if ( node != NULL ) {
+			universePtr->freeNodes = node->next;
+			node->nw = nw;
+			node->ne = ne;
+			node->sw = sw;
+			node->se = se;
+			node->result = NULL;
+			node->population = nw->population + ne->population + sw->population + se->population;
+			node->level = (char) ( nw->level + 1 );
+			node->resultLog = -1;
+			node->marked = false;
+			node->next = universePtr->buckets[ hash & ( universePtr->bucketCount - 1 ) ];
+			universePtr->buckets[ hash & ( universePtr->bucketCount - 1 ) ] = node;
+			++universePtr->nodeCount;
+		}
+	}
+	
+	return node;
+}
+
+/* Returns the canonical empty node of the given level, or NULL on malloc failure. */
+HashLifeNode *emptyHashLifeNode( HashLife *universePtr, int level ) {
+	if ( universePtr->empty[level] == NULL ) {
+		HashLifeNode *below = emptyHashLifeNode( universePtr, level - 1 );
+		if ( below != NULL ) {
+			universePtr->empty[level] = joinHashLifeNodes( universePtr, below, below, below, below );
+		}
+	}
+	return universePtr->empty[level];
+}
+
+/* The centre of a level 2 node ( 4 by 4 cells ) one generation later, by direct counting. */
+static HashLifeNode *advanceHashLifeLeaf( HashLife *universePtr, HashLifeNode *node ) {
+	HashLifeNode *cells[4][4] = {
+		{ node->nw->nw, node->nw->ne, node->ne->nw, node->ne->ne },
+		{ node->nw->sw, node->nw->se, node->ne->sw, node->ne->se },
+		{ node->sw->nw, node->sw->ne, node->se->nw, node->se->ne },
+		{ node->sw->sw, node->sw->se, node->se->sw, node->se->se }
+	};
+	HashLifeNode *next[2][2];
+	
+	for ( int i = 1; i <= 2; ++i ) {
+		for ( int j = 1; j <= 2; ++j ) {
+			unsigned long long neighbors = 0;
+			for ( int di = -1; di <= 1; ++di ) {
+				for ( int dj = -1; dj <= 1; ++dj ) {
+					neighbors += ( di != 0 || dj != 0 ) ? cells[ i + di ][ j + dj ]->population : 0;
+				}
+			}
+			bool alive = ( neighbors == 3 ) || ( neighbors == 2 && cells[i][j]->population == 1 );
+			next[ i - 1 ][ j - 1 ] = alive ? &(universePtr->liveCell) : &(universePtr->deadCell);
+		}
+	}
+	
+	return joinHashLifeNodes( universePtr, next[0][0], next[0][1], next[1][0], next[1][1] );
+}
+
+/* Returns the centre of node ( level n >= 2, one level down ) 2^log2Generations generations later, for 0 <= log2Generations <= n - 2.
+ * The nine overlapping subsquares one level down are either advanced by 2^( n - 3 ) (full speed) or only centred (smaller steps),
+ * then recombined into four squares that are advanced once more. Results are memoized per node. Returns NULL on malloc failure. */
+HashLifeNode *advanceHashLifeNode( HashLife *universePtr, HashLifeNode *node, int log2Generations ) {
+	HashLifeNode *result = NULL;
+	int level = node->level;
+	
+	if ( node->population == 0 ) {
+		result = emptyHashLifeNode( universePtr, level - 1 );
+	} else if ( node->resultLog == log2Generations ) {
+		result = node->result;
+	} else if ( level == 2 ) {
+		result = advanceHashLifeLeaf( universePtr, node );
+	} else {
+		HashLifeNode *nw = node->nw;
+		HashLifeNode *ne = node->ne;
+		HashLifeNode *sw = node->sw;
+		HashLifeNode *se = node->se;
+		HashLifeNode *sub[3][3] = {
+			{ nw, joinHashLifeNodes( universePtr, nw->ne, ne->nw, nw->se, ne->sw ), ne },
+			{ joinHashLifeNodes( universePtr, nw->sw, nw->se, sw->nw, sw->ne ), joinHashLifeNodes( universePtr, nw->se, ne->sw, sw->ne, se->nw ), joinHashLifeNodes( universePtr, ne->sw, ne->se, se->nw, se->ne ) },
+			{ sw, joinHashLifeNodes( universePtr, sw->ne, se->nw, sw->se, se->sw ), se }
+		};
+		bool fullSpeed = ( log2Generations == level - 2 );
+		bool failed = false;
+		
+		for ( int i = 0; i < 3; ++i ) {
+			for ( int j = 0; j < 3; ++j ) {
+				HashLifeNode *square = sub[i][j];
+				if ( square == NULL ) {
+					failed = true;
+				} else if ( fullSpeed ) {
+					sub[i][j] = advanceHashLifeNode( universePtr, square, level - 3 );
+				} else {
+					sub[i][j] = joinHashLifeNodes( universePtr, square->nw->se, square->ne->sw, square->sw->ne, square->se->nw );
+				}
+				failed = failed || sub[i][j] == NULL;
+			}
+		}
+		if ( failed == false ) {
+			int remainingLog = fullSpeed ? level - 3 : log2Generations;
+			HashLifeNode *quadrants[2][2];
+			for ( int i = 0; i < 2; ++i ) {
+				for ( int j = 0; j < 2; ++j ) {
+					HashLifeNode *square = joinHashLifeNodes( universePtr, sub[i][j], sub[i][ j + 1 ], sub[ i + 1 ][j], sub[ i + 1 ][ j + 1 ] );
+					quadrants[i][j] = ( square == NULL ) ? NULL : advanceHashLifeNode( universePtr, square, remainingLog );
+					failed = failed || quadrants[i][j] == NULL;
+				}
+			}
+			if ( failed == false ) {
+				result = joinHashLifeNodes( universePtr, quadrants[0][0], quadrants[0][1], quadrants[1][0], quadrants[1][1] );
+			}
+		}
+	}
+	if ( result != NULL && node->population != 0 ) {
+		node->result = result;
+		node->resultLog = (char) log2Generations;
+	}
+	
+	return result;
+}
+
+
+/* Plane - create & destroy */
+
+/* Creates an empty Plane. Returns a pointer to it, if successful. Returns a NULL pointer otherwise. */
+Plane *createPlane() {
+	Plane *newPlanePtr = (Plane *) malloc( sizeof( Plane ) );
+	
+	if ( newPlanePtr != NULL ) {
+		newPlanePtr->slotCount = GOL__PLANE__MIN_SLOTS;
+		newPlanePtr->slots = (PlaneSlot *) calloc( newPlanePtr->slotCount, sizeof( PlaneSlot ) );
+		newPlanePtr->chunkCount = 0;
+		newPlanePtr->current = 0;
+		newPlanePtr->generation = 0;
+		if ( newPlanePtr->slots == NULL ) {
+			free( newPlanePtr );
+			newPlanePtr = NULL;
+		}
+	}
+	if ( newPlanePtr == NULL ) {
+		fprintf( stderr, "ERROR: Could not allocate memory to create a plane.\n" );
+	}
+	
+	return newPlanePtr;
+}
+
+/* Destroys the Plane pointed at by oldPlanePtr. Frees the memory. */
+void destroyPlane( Plane *oldPlanePtr ) {
+	for ( size_t i = 0; i < oldPlanePtr->slotCount; ++i ) {
+		free( oldPlanePtr->slots[i].chunkPtr );
+	}
+	free( oldPlanePtr->slots );
+	free( oldPlanePtr );
+}
+
+
+/* Plane - getter and setter */
+
+/* Reads a single cell of the Plane. Cells outside all chunks are off. Returns GOL__CELL_STATE__OFF or GOL__CELL_STATE__ON. */
+CellState getPlaneCell( Plane *planePtr, long long x, long long y ) {
+	lldiv_t divisionX = lldivPositive( x, GOL__CHUNK__SIZE );
+	lldiv_t divisionY = lldivPositive( y, GOL__CHUNK__SIZE );
+	PlaneChunk *chunkPtr = findPlaneChunk( planePtr, divisionX.quot, divisionY.quot );
+	
+	CellState state = GOL__CELL_STATE__OFF;
+	
+	if ( chunkPtr != NULL && ( ( chunkPtr->rows[ planePtr->current ][ divisionX.rem ] >> divisionY.rem ) & 1 ) ) {
+		state = GOL__CELL_STATE__ON;
+	}
+	
+	return state;
+}
+
+/* Writes a single cell of the Plane, creating its chunk if necessary. Returns 0 on success; > 0 on error. */
+ErrorChar setPlaneCell( Plane *planePtr, long long x, long long y, CellState newState ) {
+	ErrorChar error = 0;
+	
+	lldiv_t divisionX = lldivPositive( x, GOL__CHUNK__SIZE );
+	lldiv_t divisionY = lldivPositive( y, GOL__CHUNK__SIZE );
+	PlaneChunk *chunkPtr = findPlaneChunk( planePtr, divisionX.quot, divisionY.quot );
+	uint64_t bit = 1ULL << divisionY.rem;
+	
+	if ( newState == GOL__CELL_STATE__OFF ) {
+		if ( chunkPtr != NULL ) {
+			chunkPtr->rows[ planePtr->current ][ divisionX.rem ] &= ~bit;
+		}
+	} else if ( newState == GOL__CELL_STATE__ON ) {
+		if ( chunkPtr == NULL ) {
+			chunkPtr = insertPlaneChunk( planePtr, divisionX.quot, divisionY.quot );
+		}
+		if ( chunkPtr == NULL ) {
+			error = 1;
+		} else {
+			chunkPtr->rows[ planePtr->current ][ divisionX.rem ] |= bit;
+		}
+	} else { // invalid newState
+		error = 2;
+		fprintf( stderr, "ERROR: newState == %d is invalid. Valid values are only %d and %d.\n", newState, GOL__CELL_STATE__OFF, GOL__CELL_STATE__ON );
+	}
+	
+	return error;
+}
+
+
+/* Plane - import & export */
+
+/* Replaces the contents of the Plane with the current Grid of the Game; cell ( x, y ) of the Grid becomes cell ( x, y ) of the Plane.
+ * Whole words are moved at a time. The generation count restarts at 0. Returns 0 on success; > 0 on error: 2 if the rule of the Game is not
+ * Conway's, in which case the Plane is unchanged, or 1 on malloc failure, in which case the Plane may hold part of the Grid. */
+ErrorChar importGameIntoPlane( Plane *planePtr, Game *gamePtr ) {
+	ErrorChar error = 0;
+	
+	Grid *gridPtr = gamePtr->currentGridPtr;
+	size_t rowWords = bitboardRowWords( gridPtr );
+	uint64_t *buffer = (uint64_t *) malloc( ( rowWords + 2 ) * sizeof( uint64_t ) );
+	
+	if ( gamePtr->rule.family != GOL__RULE__CONWAY ) {
+		error = 2;
+		fprintf( stderr, "ERROR: The Plane only runs Conway's rule (B3/S23).\n" );
+	} else {
+		for ( size_t i = 0; i < planePtr->slotCount; ++i ) {
+			free( planePtr->slots[i].chunkPtr );
+			planePtr->slots[i].chunkPtr = NULL;
+		}
+		planePtr->chunkCount = 0;
+		planePtr->generation = 0;
+		if ( buffer == NULL ) {
+			error = 1;
+		} else {
+			uint64_t *words = buffer + 1;
+			long long lastWord = ( gridPtr->gridSizeY - 1 ) / GOL__BITBOARD__CELLS_PER_WORD;
+			uint64_t lastMask = ( gridPtr->gridSizeY % GOL__BITBOARD__CELLS_PER_WORD == 0 ) ? ~0ULL : ( 1ULL << ( gridPtr->gridSizeY % GOL__BITBOARD__CELLS_PER_WORD ) ) - 1;
+			for ( long long x = 0; error == 0 && x < gridPtr->gridSizeX; ++x ) {
+				packGridRow( gridPtr, x, 0, rowWords, words );
+				for ( long long k = 0; error == 0 && k <= lastWord; ++k ) {
+					uint64_t word = ( k == lastWord ) ? words[k] & lastMask : words[k]; // without the ghost cell
+					if ( word != 0 ) {
+						long long chunkX = x / GOL__CHUNK__SIZE;
+						PlaneChunk *chunkPtr = findPlaneChunk( planePtr, chunkX, k );
+						if ( chunkPtr == NULL ) {
+							chunkPtr = insertPlaneChunk( planePtr, chunkX, k );
+						}
+						if ( chunkPtr == NULL ) {
+							error = 1;
+						} else {
+							chunkPtr->rows[ planePtr->current ][ x % GOL__CHUNK__SIZE ] = word;
+						}
+					}
+				}
+			}
+		}
+		if ( error != 0 ) {
+			fprintf( stderr, "ERROR: Could not allocate memory to import a grid with dimensions %lld by %lld into a plane.\n", gridPtr->gridSizeX, gridPtr->gridSizeY );
+		}
+	}
+	free( buffer );
+	
+	return error;
+}
+
+/* Returns 64 cells of the current generation of the Plane in row x, starting at column y. */
+static uint64_t readPlaneWord( Plane *planePtr, long long x, long long y ) {
+	lldiv_t divisionX = lldivPositive( x, GOL__CHUNK__SIZE );
+	lldiv_t divisionY = lldivPositive( y, GOL__CHUNK__SIZE );
+	PlaneChunk *leftPtr = findPlaneChunk( planePtr, divisionX.quot, divisionY.quot );
+	uint64_t word = 0;
+	
+	if ( leftPtr != NULL ) {
+		word = leftPtr->rows[ planePtr->current ][ divisionX.rem ] >> divisionY.rem;
+	}
+	if ( divisionY.rem != 0 ) {
+		PlaneChunk *rightPtr = findPlaneChunk( planePtr, divisionX.quot, divisionY.quot + 1 );
+		if ( rightPtr != NULL ) {
+			word |= rightPtr->rows[ planePtr->current ][ divisionX.rem ] << ( GOL__CHUNK__SIZE - divisionY.rem );
+		}
+	}
+	
+	return word;
+}
+
+/* Overwrites the current Grid of the Game with the window of the Plane whose top left cell is ( originX, originY ). */
+void exportPlaneToGame( Plane *planePtr, Game *gamePtr, long long originX, long long originY ) {
+	Grid *gridPtr = gamePtr->currentGridPtr;
+	size_t rowWords = (size_t) ( gridPtr->gridSizeY + GOL__BITBOARD__CELLS_PER_WORD - 1 ) / GOL__BITBOARD__CELLS_PER_WORD;
+	uint64_t *words = (uint64_t *) malloc( ( rowWords + 1 ) * sizeof( uint64_t ) );
+	
+	finishGameSnapshot( gamePtr );
+	if ( words == NULL ) {
+		fprintf( stderr, "ERROR: Could not allocate memory to export a plane into a grid with dimensions %lld by %lld.\n", gridPtr->gridSizeX, gridPtr->gridSizeY );
+	} else {
+		for ( long long x = 0; x < gridPtr->gridSizeX; ++x ) {
+			for ( size_t k = 0; k < rowWords; ++k ) {
+				words[k] = readPlaneWord( planePtr, originX + x, originY + (long long) k * GOL__BITBOARD__CELLS_PER_WORD );
+			}
+			unpackGridRow( gridPtr, x, 0, rowWords, words );
+		}
+		invalidateGameActivity( gamePtr );
+	}
+	free( words );
+}
+
+
+/* Plane - stepping */
+
+/* One generation of the Plane.
+ * First every chunk with live cells on an edge gets the neighbor chunks on that side, so that the pattern can grow into them.
+ * Then each chunk is stepped with the bitboard kernel, its neighbors supplying the ghost rows and columns. Finally empty chunks are freed.
+ * Returns 0 on success; > 0 on malloc failure, in which case the Plane is unchanged. */
+ErrorChar iteratePlane( Plane *planePtr ) {
+	ErrorChar error = 0;
+	
+	int current = planePtr->current;
+	int next = 1 - current;
+	size_t pendingCount = 0;
+	/* Chunk coordinates to add or remove: growing adds at most 8 chunks per chunk, so at most 9 times as many may die afterwards. */
+	long long *pending = (long long *) malloc( ( 9 * planePtr->chunkCount + 1 ) * 2 * sizeof( long long ) );
+	
+	if ( pending == NULL ) {
+		error = 1;
+	} else {
+		/* Grow: collect first, as inserting may move the slots. */
+		for ( size_t i = 0; i < planePtr->slotCount; ++i ) {
+			PlaneChunk *chunkPtr = planePtr->slots[i].chunkPtr;
+			if ( chunkPtr != NULL ) {
+				const uint64_t *rows = chunkPtr->rows[current];
+				uint64_t anyRow = 0;
+				for ( int r = 0; r < GOL__CHUNK__SIZE; ++r ) {
+					anyRow |= rows[r];
+				}
+				bool north = rows[0] != 0;
+				bool south = rows[ GOL__CHUNK__SIZE - 1 ] != 0;
+				bool west = ( anyRow & 1 ) != 0;
+				bool east = ( anyRow >> 63 ) != 0;
+				bool edges[3][3] = {
+					{ ( rows[0] & 1 ) != 0, north, ( rows[0] >> 63 ) != 0 },
+					{ west, false, east },
+					{ ( rows[ GOL__CHUNK__SIZE - 1 ] & 1 ) != 0, south, ( rows[ GOL__CHUNK__SIZE - 1 ] >> 63 ) != 0 }
+				};
+				for ( int dx = -1; dx <= 1; ++dx ) {
+					for ( int dy = -1; dy <= 1; ++dy ) {
+						long long neighborX = planePtr->slots[i].chunkX + dx;
+						long long neighborY = planePtr->slots[i].chunkY + dy;
+						if ( edges[ dx + 1 ][ dy + 1 ] && findPlaneChunk( planePtr, neighborX, neighborY ) == NULL ) {
+							pending[ 2 * pendingCount ] = neighborX;
+							pending[ 2 * pendingCount + 1 ] = neighborY;
+							++pendingCount;
+						}
+					}
+				}
+			}
+		}
+		size_t insertedCount = 0; // the inserted chunks are moved to the front of pending, behind the ones already read
+		for ( size_t p = 0; error == 0 && p < pendingCount; ++p ) {
+			long long chunkX = pending[ 2 * p ];
+			long long chunkY = pending[ 2 * p + 1 ];
+			if ( findPlaneChunk( planePtr, chunkX, chunkY ) == NULL ) {
+				if ( insertPlaneChunk( planePtr, chunkX, chunkY ) == NULL ) {
+					error = 1;
+				} else {
+					pending[ 2 * insertedCount ] = chunkX;
+					pending[ 2 * insertedCount + 1 ] = chunkY;
+					++insertedCount;
+				}
+			}
+		}
+		/* Rollback: */
+		for ( size_t p = 0; error != 0 && p < insertedCount; ++p ) {
+			removePlaneChunk( planePtr, pending[ 2 * p ], pending[ 2 * p + 1 ] );
+		}
+	}
+	if ( error == 0 ) {
+		/* Step: rows -1 .. 64 of words -1 .. 1 around each chunk. */
+		uint64_t padded[ GOL__CHUNK__SIZE + 2 ][3];
+		uint64_t out[1];
+		pendingCount = 0;
+		for ( size_t i = 0; i < planePtr->slotCount; ++i ) {
+			PlaneChunk *chunkPtr = planePtr->slots[i].chunkPtr;
+			if ( chunkPtr != NULL ) {
+				long long chunkX = planePtr->slots[i].chunkX;
+				long long chunkY = planePtr->slots[i].chunkY;
+				for ( int dx = -1; dx <= 1; ++dx ) {
+					for ( int dy = -1; dy <= 1; ++dy ) {
+						PlaneChunk *neighborPtr = ( dx == 0 && dy == 0 ) ? chunkPtr : findPlaneChunk( planePtr, chunkX + dx, chunkY + dy );
+						int firstRow = ( dx == -1 ) ? GOL__CHUNK__SIZE - 1 : 0;
+						int rowCount = ( dx == 0 ) ? GOL__CHUNK__SIZE : 1;
+						int firstPadded = ( dx == -1 ) ? 0 : ( dx == 0 ) ? 1 : GOL__CHUNK__SIZE + 1;
+						for ( int r = 0; r < rowCount; ++r ) {
+							padded[ firstPadded + r ][ dy + 1 ] = ( neighborPtr == NULL ) ? 0 : neighborPtr->rows[current][ firstRow + r ];
+						}
+					}
+				}
+				uint64_t anyRow = 0;
+				for ( int r = 0; r < GOL__CHUNK__SIZE; ++r ) {
+					stepBitboardRow( padded[r] + 1, padded[ r + 1 ] + 1, padded[ r + 2 ] + 1, out, 1, NULL );
+					chunkPtr->rows[next][r] = out[0];
+					anyRow |= out[0];
+				}
+				if ( anyRow == 0 ) {
+					pending[ 2 * pendingCount ] = chunkX;
+					pending[ 2 * pendingCount + 1 ] = chunkY;
+					++pendingCount;
+				}
+			}
+		}
+		/* Shrink: remove the chunks that died, after all chunks read their neighbors. */
+		for ( size_t p = 0; p < pendingCount; ++p ) {
+			removePlaneChunk( planePtr, pending[ 2 * p ], pending[ 2 * p + 1 ] );
+		}
+		planePtr->current = next;
+		++planePtr->generation;
+	}
+	free( pending );
+	if ( error != 0 ) {
+		fprintf( stderr, "ERROR: Could not allocate memory to iterate a plane with %zu chunks.\n", planePtr->chunkCount );
+	}
+	
+	return error;
+}
+
+/* Returns the number of live cells on the Plane. */
+unsigned long long planePopulation( Plane *planePtr ) {
+	unsigned long long population = 0;
+	
+	for ( size_t i = 0; i < planePtr->slotCount; ++i ) {
+		PlaneChunk *chunkPtr = planePtr->slots[i].chunkPtr;
+		if ( chunkPtr != NULL ) {
+			for ( int r = 0; r < GOL__CHUNK__SIZE; ++r ) {
+				population += (unsigned long long) __builtin_popcountll( chunkPtr->rows[ planePtr->current ][r] );
+			}
+		}
+	}
+	
+	return population;
+}
+
+
+/* Plane - chunk map */
+
+/* Returns the home slot of a chunk. */
+static size_t planeSlotIndex( Plane *planePtr, long long chunkX, long long chunkY ) {
+	uint64_t hash = (uint64_t) chunkX * 0x9E3779B97F4A7C15ULL ^ (uint64_t) chunkY;
+	/* splitmix64 finalizer */
+	hash = ( hash ^ ( hash >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+	hash = ( hash ^ ( hash >> 27 ) ) * 0x94D049BB133111EBULL;
+	hash ^= hash >> 31;
+	return (size_t) hash & ( planePtr->slotCount - 1 );
+}
+
+/* Returns the chunk at the given chunk coordinates, or NULL if there is none. */
+PlaneChunk *findPlaneChunk( Plane *planePtr, long long chunkX, long long chunkY ) {
+	size_t mask = planePtr->slotCount - 1;
+	size_t i = planeSlotIndex( planePtr, chunkX, chunkY );
+	
+	while ( planePtr->slots[i].chunkPtr != NULL && ( planePtr->slots[i].chunkX != chunkX || planePtr->slots[i].chunkY != chunkY ) ) {
+		i = ( i + 1 ) & mask;
+	}
+	
+	return planePtr->slots[i].chunkPtr;
+}
+
+/* Moves all chunks into a table of newSlotCount slots. Returns 0 on success; > 0 on malloc failure, in which case nothing changes. */
+static ErrorChar resizePlaneSlots( Plane *planePtr, size_t newSlotCount ) {
+	ErrorChar error = 0;
+	
+	PlaneSlot *oldSlots = planePtr->slots;
+	size_t oldSlotCount = planePtr->slotCount;
+	PlaneSlot *newSlots = (PlaneSlot *) calloc( newSlotCount, sizeof( PlaneSlot ) );
+	
+	if ( newSlots == NULL ) {
+		error = 1;
+	} else {
+		planePtr->slots = newSlots;
+		planePtr->slotCount = newSlotCount;
+		for ( size_t i = 0; i < oldSlotCount; ++i ) {
+			if ( oldSlots[i].chunkPtr != NULL ) {
+				size_t j = planeSlotIndex( planePtr, oldSlots[i].chunkX, oldSlots[i].chunkY );
+				while ( newSlots[j].chunkPtr != NULL ) {
+					j = ( j + 1 ) & ( newSlotCount - 1 );
+				}
+				newSlots[j] = oldSlots[i];
+			}
+		}
+		free( oldSlots );
+	}
+	
+	return error;
+}
+
+/* Adds an empty chunk at the given chunk coordinates, which must not have one yet. Returns it, or NULL on malloc failure. */
+PlaneChunk *insertPlaneChunk( Plane *planePtr, long long chunkX, long long chunkY ) {
+	PlaneChunk *chunkPtr = NULL;
+	
+	if ( 2 * ( planePtr->chunkCount + 1 ) <= planePtr->slotCount || resizePlaneSlots( planePtr, 2 * planePtr->slotCount ) == 0 ) {
+		chunkPtr = (PlaneChunk *) calloc( 1, sizeof( PlaneChunk ) );
+	}
+	if ( chunkPtr != NULL ) {
+		size_t i = planeSlotIndex( planePtr, chunkX, chunkY );
+		while ( planePtr->slots[i].chunkPtr != NULL ) {
+			i = ( i + 1 ) & ( planePtr->slotCount - 1 );
+		}
+		planePtr->slots[i].chunkX = chunkX;
+		planePtr->slots[i].chunkY = chunkY;
+		planePtr->slots[i].chunkPtr = chunkPtr;
+		++planePtr->chunkCount;
+	}
+	
+	return chunkPtr;
+}
+
+/* Frees the chunk at the given chunk coordinates, if there is one. Later chunks of the probe sequence are shifted back into the gap,
+ * so lookups never need tombstones. The table shrinks when it is less than an eighth full. */
+void removePlaneChunk( Plane *planePtr, long long chunkX, long long chunkY ) {
+	size_t mask = planePtr->slotCount - 1;
+	size_t i = planeSlotIndex( planePtr, chunkX, chunkY );
+	
+	while ( planePtr->slots[i].chunkPtr != NULL && ( planePtr->slots[i].chunkX != chunkX || planePtr->slots[i].chunkY != chunkY ) ) {
+		i = ( i + 1 ) & mask;
+	}
+	if ( planePtr->slots[i].chunkPtr != NULL ) {
+		free( planePtr->slots[i].chunkPtr );
+		planePtr->slots[i].chunkPtr = NULL;
+		--planePtr->chunkCount;
+		
+		size_t gap = i;
+		size_t j = ( i + 1 ) & mask;
+		while ( planePtr->slots[j].chunkPtr != NULL ) {
+			size_t home = planeSlotIndex( planePtr, planePtr->slots[j].chunkX, planePtr->slots[j].chunkY );
+			/* Move j into the gap, unless its home lies cyclically in ( gap, j ]. */
+			if ( ( ( j - home ) & mask ) >= ( ( j - gap ) & mask ) ) {
+				planePtr->slots[gap] = planePtr->slots[j];
+				planePtr->slots[j].chunkPtr = NULL;
+				gap = j;
+			}
+			j = ( j + 1 ) & mask;
+		}
+		if ( planePtr->slotCount > GOL__PLANE__MIN_SLOTS && 8 * planePtr->chunkCount < planePtr->slotCount ) {
+			resizePlaneSlots( planePtr, planePtr->slotCount / 2 ); // on failure the table just stays larger
+		}
+	}
+}
+
+
+/* Game batch - create & destroy */
+
+/* Creates a GameBatch of 64 empty Games of gridSizeX by gridSizeY cells with Conway's rule. Returns a pointer to it, if successful.
+ * Returns a NULL pointer otherwise. */
+GameBatch *createGameBatch( long long gridSizeX, long long gridSizeY, char outOfBoundsRule ) {
+	GameBatch *newBatchPtr = NULL;
+	
+	if ( gridSizeX < 1 || gridSizeY < 1 ) {
+		fprintf( stderr, "ERROR: ( gridSizeX, gridSizeY ) == ( %lld, %lld ) is invalid. A batch needs at least one cell.\n", gridSizeX, gridSizeY );
+	} else if ( outOfBoundsRule != GOL__OOBR__ALL_OFF && outOfBoundsRule != GOL__OOBR__ALL_ON && outOfBoundsRule != GOL__OOBR__TORUS ) {
+		fprintf( stderr, "ERROR: outOfBoundsRule == %d is invalid.\n", outOfBoundsRule );
+	} else {
+		size_t words = (size_t) ( gridSizeX + 2 ) * (size_t) ( gridSizeY + 2 );
+		newBatchPtr = (GameBatch *) malloc( sizeof( GameBatch ) );
+		if ( newBatchPtr != NULL ) {
+			newBatchPtr->cells = (uint64_t *) calloc( 3 * words, sizeof( uint64_t ) );
+			if ( newBatchPtr->cells == NULL ) {
+				free( newBatchPtr );
+				newBatchPtr = NULL;
+			}
+		}
+		if ( newBatchPtr == NULL ) {
+			fprintf( stderr, "ERROR: Could not allocate memory to create a batch of grids with dimensions %lld by %lld.\n", gridSizeX, gridSizeY );
+		} else {
+			newBatchPtr->gridSizeX = gridSizeX;
+			newBatchPtr->gridSizeY = gridSizeY;
+			newBatchPtr->outOfBoundsRule = outOfBoundsRule;
+			parseRule( "B3/S23", &(newBatchPtr->rule) );
+			newBatchPtr->current = newBatchPtr->cells;
+			newBatchPtr->previous = newBatchPtr->cells + words;
+			newBatchPtr->next = newBatchPtr->cells + 2 * words;
+			newBatchPtr->extinctLanes = ~0ULL;
+			newBatchPtr->stableLanes = 0;
+			newBatchPtr->oscillatingLanes = 0;
+			newBatchPtr->editedLanes = 0;
+			newBatchPtr->generation = 0;
+		}
+	}
+	
+	return newBatchPtr;
+}
+
+/* Destroys the GameBatch pointed at by oldBatchPtr. Frees the memory. */
+void destroyGameBatch( GameBatch *oldBatchPtr ) {
+	free( oldBatchPtr->cells );
+	free( oldBatchPtr );
+}
+
+
+/* Game batch - cells */
+
+/* Returns the word of cell ( x, y ) in the current generation, -1 <= x <= gridSizeX and -1 <= y <= gridSizeY. */
+static inline uint64_t *gameBatchWord( GameBatch *batchPtr, uint64_t *cells, long long x, long long y ) {
+	return cells + ( x + 1 ) * ( batchPtr->gridSizeY + 2 ) + ( y + 1 );
+}
+
+/* Reads a single cell of one lane. Returns GOL__CELL_STATE__OFF, GOL__CELL_STATE__ON, or GOL__CELL_STATE__INVALID for a cell or lane out of range. */
+CellState getGameBatchCell( GameBatch *batchPtr, int lane, long long x, long long y ) {
+	CellState state = GOL__CELL_STATE__INVALID;
+	
+	if ( lane >= 0 && lane < 64 && x >= 0 && x < batchPtr->gridSizeX && y >= 0 && y < batchPtr->gridSizeY ) {
+		state = (CellState) ( ( *gameBatchWord( batchPtr, batchPtr->current, x, y ) >> lane ) & 1 );
+	}
+	
+	return state;
+}
+
+/* Writes a single cell of one lane. The lane counts as unsettled afterwards, and cannot count as oscillating after the next generation either,
+ * as the generation before the edit says nothing about it. Returns 0 on success; > 0 on error. */
+ErrorChar setGameBatchCell( GameBatch *batchPtr, int lane, long long x, long long y, CellState newState ) {
+	ErrorChar error = 0;
+	
+	if ( lane < 0 || lane >= 64 || x < 0 || x >= batchPtr->gridSizeX || y < 0 || y >= batchPtr->gridSizeY ) {
+		error = 1;
+		fprintf( stderr, "ERROR: Cell %d: ( %lld, %lld ) is outside the batch.\n", lane, x, y );
+	} else if ( newState != GOL__CELL_STATE__OFF && newState != GOL__CELL_STATE__ON ) {
+		error = 2;
+		fprintf( stderr, "ERROR: newState == %d is invalid. Valid values are only %d and %d.\n", newState, GOL__CELL_STATE__OFF, GOL__CELL_STATE__ON );
+	} else {
+		uint64_t *wordPtr = gameBatchWord( batchPtr, batchPtr->current, x, y );
+		uint64_t bit = 1ULL << lane;
+		*wordPtr = ( newState == GOL__CELL_STATE__ON ) ? ( *wordPtr | bit ) : ( *wordPtr & ~bit );
+		if ( newState == GOL__CELL_STATE__ON ) {
+			batchPtr->extinctLanes &= ~bit;
+		}
+		batchPtr->stableLanes &= ~bit;
+		batchPtr->oscillatingLanes &= ~bit;
+		batchPtr->editedLanes |= bit;
+	}
+	
+	return error;
+}
+
+/* Fills every lane with a random soup in which each cell is alive with probability density ( to 1 / 256 ), and restarts the batch at generation 0.
+ * The same seed gives the same soups. Each random bit combines up to eight words of splitmix64 output with AND for a 0 and OR for a 1 in the binary
+ * expansion of density, from the last digit to the first, so 64 lanes cost one word per digit. */
+void randomizeGameBatch( GameBatch *batchPtr, uint64_t seed, double density ) {
+	unsigned int digits = ( density <= 0.0 ) ? 0 : ( density >= 1.0 ) ? 256 : (unsigned int) ( density * 256.0 + 0.5 );
+	uint64_t state = seed;
+	
+	for ( long long x = 0; x < batchPtr->gridSizeX; ++x ) {
+		for ( long long y = 0; y < batchPtr->gridSizeY; ++y ) {
+			uint64_t word = ( digits >= 256 ) ? ~0ULL : 0;
+			for ( int d = ( digits == 0 || digits >= 256 ) ? 8 : __builtin_ctz( digits ); d < 8; ++d ) { // trailing 0 digits would only AND a word of 0
+				/* splitmix64 */
+				uint64_t random = ( state += 0x9E3779B97F4A7C15ULL );
+				random = ( random ^ ( random >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+				random = ( random ^ ( random >> 27 ) ) * 0x94D049BB133111EBULL;
+				random ^= random >> 31;
+				word = ( ( digits >> d ) & 1 ) ? ( word | random ) : ( word & random );
+			}
+			*gameBatchWord( batchPtr, batchPtr->current, x, y ) = word;
+		}
+	}
+	batchPtr->extinctLanes = ( digits == 0 ) ? ~0ULL : 0;
+	batchPtr->stableLanes = 0;
+	batchPtr->oscillatingLanes = 0;
+	batchPtr->editedLanes = 0;
+	batchPtr->generation = 0;
+}
+
+/* Returns the number of live cells of one lane. */
+unsigned long long gameBatchLanePopulation( GameBatch *batchPtr, int lane ) {
+	unsigned long long population = 0;
+	
+	for ( long long x = 0; x < batchPtr->gridSizeX; ++x ) {
+		const uint64_t *row = gameBatchWord( batchPtr, batchPtr->current, x, 0 );
+		for ( long long y = 0; y < batchPtr->gridSizeY; ++y ) {
+			population += ( row[y] >> lane ) & 1;
+		}
+	}
+	
+	return population;
+}
+
+/* Copies one lane into the current Grid of the Game, which must have the size of the batch. The Game keeps its own rule and outOfBoundsRule.
+ * Returns 0 on success; > 0 if the lane is out of range or the sizes differ, in which case the Game is unchanged. */
+ErrorChar exportGameBatchLane( GameBatch *batchPtr, int lane, Game *gamePtr ) {
+	ErrorChar error = 0;
+	
+	Grid *gridPtr = gamePtr->currentGridPtr;
+	
+	if ( lane < 0 || lane >= 64 ) {
+		error = 1;
+		fprintf( stderr, "ERROR: lane == %d is invalid. Valid lanes are 0 to 63.\n", lane );
+	} else if ( gridPtr->gridSizeX != batchPtr->gridSizeX || gridPtr->gridSizeY != batchPtr->gridSizeY ) {
+		error = 2;
+		fprintf( stderr, "ERROR: A lane of a batch with dimensions %lld by %lld does not fit into a grid with dimensions %lld by %lld.\n",
+			batchPtr->gridSizeX, batchPtr->gridSizeY, gridPtr->gridSizeX, gridPtr->gridSizeY );
+	} else {
+		finishGameSnapshot( gamePtr );
+		for ( long long x = 0; x < batchPtr->gridSizeX; ++x ) {
+			for ( long long y = 0; y < batchPtr->gridSizeY; ++y ) {
+				setCell( gamePtr->currentGridPtr, x, y, getGameBatchCell( batchPtr, lane, x, y ) );
+			}
+		}
+		invalidateGameActivity( gamePtr );
+	}
+	
+	return error;
+}
+
+
+/* Game batch - stepping */
+
+/* Sets the rule of all lanes from B/S notation (see parseRule). Returns 0 on success; > 0 on invalid notation, in which case nothing changes. */
+ErrorChar setGameBatchRule( GameBatch *batchPtr, const char *notation ) {
+	Rule rule;
+	ErrorChar error = parseRule( notation, &rule );
+	
+	if ( error == 0 ) {
+		batchPtr->rule = rule;
+	}
+	
+	return error;
+}
+
+/* Writes the halo of the current generation: words of 0 or ~0, or the opposite side of the torus. */
+static void fillGameBatchHalo( GameBatch *batchPtr ) {
+	long long sizeX = batchPtr->gridSizeX;
+	long long sizeY = batchPtr->gridSizeY;
+	uint64_t *cells = batchPtr->current;
+	
+	if ( batchPtr->outOfBoundsRule == GOL__OOBR__TORUS ) {
+		for ( long long x = 0; x < sizeX; ++x ) {
+			*gameBatchWord( batchPtr, cells, x, -1 ) = *gameBatchWord( batchPtr, cells, x, sizeY - 1 );
+			*gameBatchWord( batchPtr, cells, x, sizeY ) = *gameBatchWord( batchPtr, cells, x, 0 );
+		}
+		memcpy( gameBatchWord( batchPtr, cells, -1, -1 ), gameBatchWord( batchPtr, cells, sizeX - 1, -1 ), (size_t) ( sizeY + 2 ) * sizeof( uint64_t ) );
+		memcpy( gameBatchWord( batchPtr, cells, sizeX, -1 ), gameBatchWord( batchPtr, cells, 0, -1 ), (size_t) ( sizeY + 2 ) * sizeof( uint64_t ) );
+	} else {
+		uint64_t outside = ( batchPtr->outOfBoundsRule == GOL__OOBR__ALL_ON ) ? ~0ULL : 0;
+		for ( long long y = -1; y <= sizeY; ++y ) {
+			*gameBatchWord( batchPtr, cells, -1, y ) = outside;
+			*gameBatchWord( batchPtr, cells, sizeX, y ) = outside;
+		}
+		for ( long long x = 0; x < sizeX; ++x ) {
+			*gameBatchWord( batchPtr, cells, x, -1 ) = outside;
+			*gameBatchWord( batchPtr, cells, x, sizeY ) = outside;
+		}
+	}
+}
+
+/* Steps every cell of the batch with the rule expression NEXT ( see GOL__ROW_KERNEL_LOOP ) and collects the lane masks. */
+#define GOL__BATCH_LOOP( NEXT ) \
+	for ( long long x = 0; x < batchPtr->gridSizeX; ++x ) { \
+		const uint64_t *above = gameBatchWord( batchPtr, batchPtr->current, x - 1, 0 ); \
+		const uint64_t *mid = gameBatchWord( batchPtr, batchPtr->current, x, 0 ); \
+		const uint64_t *below = gameBatchWord( batchPtr, batchPtr->current, x + 1, 0 ); \
+		const uint64_t *before = gameBatchWord( batchPtr, batchPtr->previous, x, 0 ); \
+		uint64_t *out = gameBatchWord( batchPtr, batchPtr->next, x, 0 ); \
+		for ( long long y = 0; y < batchPtr->gridSizeY; ++y ) { \
+			uint64_t m = mid[y]; \
+			GOL__SUM_NEIGHBORS( uint64_t, above[ y - 1 ], above[y], above[ y + 1 ], mid[ y - 1 ], mid[ y + 1 ], below[ y - 1 ], below[y], below[ y + 1 ] ) \
+			uint64_t next = ( NEXT ); \
+			out[y] = next; \
+			alive |= next; \
+			changed |= next ^ m; \
+			changedFromBefore |= next ^ before[y]; \
+		} \
+	}
+
+/* One generation of all 64 lanes. Afterwards extinctLanes, stableLanes and oscillatingLanes describe the new generation. */
+void iterateGameBatch( GameBatch *batchPtr ) {
+	const Rule *rulePtr = &(batchPtr->rule);
+	uint64_t alive = 0;
+	uint64_t changed = 0;
+	uint64_t changedFromBefore = 0;
+	
+	fillGameBatchHalo( batchPtr );
+	if ( rulePtr->family == GOL__RULE__CONWAY ) {
+		GOL__BATCH_LOOP( ~s2 & s1 & ( s0 | m ) )
+	} else {
+		GOL__BATCH_LOOP( GOL__GENERIC_TERM( 0 ) | GOL__GENERIC_TERM( 1 ) | GOL__GENERIC_TERM( 2 ) | GOL__GENERIC_TERM( 3 ) | GOL__GENERIC_TERM( 4 ) |
+			GOL__GENERIC_TERM( 5 ) | GOL__GENERIC_TERM( 6 ) | GOL__GENERIC_TERM( 7 ) | GOL__GENERIC_TERM( 8 ) )
+	}
+	batchPtr->extinctLanes = ~alive;
+	batchPtr->stableLanes = ~changed;
+	batchPtr->oscillatingLanes = changed & ~changedFromBefore & ~batchPtr->editedLanes & ( batchPtr->generation > 0 ? ~0ULL : 0 );
+	batchPtr->editedLanes = 0;
+	
+	uint64_t *recycled = batchPtr->previous;
+	batchPtr->previous = batchPtr->current;
+	batchPtr->current = batchPtr->next;
+	batchPtr->next = recycled;
+	++batchPtr->generation;
+}
+
+/* Iterates the batch until every lane is extinct, stable or oscillating with period 2, or for at most maxGenerations generations.
+ * Returns the number of generations run. */
+unsigned long long runGameBatch( GameBatch *batchPtr, unsigned long long maxGenerations ) {
+	unsigned long long generations = 0;
+	
+	while ( generations < maxGenerations && ( batchPtr->extinctLanes | batchPtr->stableLanes | batchPtr->oscillatingLanes ) != ~0ULL ) {
+		iterateGameBatch( batchPtr );
+		++generations;
+	}
+	
+	return generations;
+}
+
+
+/* Thread pool */
+/* A fixed set of worker threads that run one job at a time. Between jobs the workers wait at a barrier, so starting a job costs
+ * two barrier crossings instead of creating threads. Without GOL__THREADS the pool has a single thread: the caller. */
+
+#ifdef GOL__THREADS
+/* Main loop of a worker thread: wait for a job, run its share, report back. */
+static void *threadPoolWorker( void *argument ) {
+	ThreadPoolWorker *workerPtr = (ThreadPoolWorker *) argument;
+	ThreadPool *poolPtr = workerPtr->poolPtr;
+	bool running = true;
+	
+	pthread_mutex_lock( &(poolPtr->startupLock) );
+	pthread_mutex_unlock( &(poolPtr->startupLock) );
+	while ( running == true ) {
+		pthread_barrier_wait( &(poolPtr->startBarrier) );
+		if ( poolPtr->stopping == true ) {
+			running = false;
+		} else {
+			poolPtr->job( poolPtr->jobArgument, workerPtr->threadIndex, poolPtr->threadCount );
+			pthread_barrier_wait( &(poolPtr->doneBarrier) );
+		}
+	}
+	
+	return NULL;
+}
+#endif
+
+/* Creates a ThreadPool of threadCount threads, the calling thread included. Returns a pointer to it, if successful. Returns a NULL pointer otherwise. */
+ThreadPool *createThreadPool( int threadCount ) {
+	bool error = false;
+	
+	ThreadPool *newPoolPtr = NULL;
+	
+	if ( threadCount < 1 ) {
+		fprintf( stderr, "ERROR: threadCount == %d is invalid. A thread pool needs at least one thread.\n", threadCount );
+		error = true;
+	} else {
+		newPoolPtr = (ThreadPool *) malloc( sizeof( ThreadPool ) );
+		if ( newPoolPtr == NULL ) {
+			error = true;
+		} else {
+			newPoolPtr->threadCount = threadCount;
+			newPoolPtr->job = NULL;
+			newPoolPtr->jobArgument = NULL;
+			newPoolPtr->stopping = false;
+#ifdef GOL__THREADS
+			newPoolPtr->workers = (ThreadPoolWorker *) calloc( (size_t) threadCount, sizeof( ThreadPoolWorker ) );
+			if ( newPoolPtr->workers == NULL ) {
+				error = true;
+				free( newPoolPtr );
+				newPoolPtr = NULL;
+			} else {
+				pthread_mutex_init( &(newPoolPtr->startupLock), NULL );
+				pthread_mutex_lock( &(newPoolPtr->startupLock) );
+				int started = 1; // thread 0 is the caller of runThreadPool
+				while ( error == false && started < threadCount ) {
+					ThreadPoolWorker *workerPtr = &(newPoolPtr->workers[started]);
+					workerPtr->poolPtr = newPoolPtr;
+					workerPtr->threadIndex = started;
+					if ( pthread_create( &(workerPtr->thread), NULL, threadPoolWorker, workerPtr ) != 0 ) {
+						error = true;
+					} else {
+						++started;
+					}
+				}
+				pthread_barrier_init( &(newPoolPtr->startBarrier), NULL, (unsigned int) started );
+				pthread_barrier_init( &(newPoolPtr->doneBarrier), NULL, (unsigned int) started );
+				newPoolPtr->threadCount = started;
+				pthread_mutex_unlock( &(newPoolPtr->startupLock) );
+				/* Rollback: stop the threads that did start. */
+				if ( error == true ) {
+					destroyThreadPool( newPoolPtr );
+					newPoolPtr = NULL;
+				}
+			}
+#else
+			newPoolPtr->threadCount = 1;
+#endif
+		}
+		if ( error == true ) {
+			fprintf( stderr, "ERROR: Could not create a thread pool with %d threads.\n", threadCount );
+		}
+	}
+	
+	return newPoolPtr;
+}
+
+/* Stops and joins the workers of the ThreadPool pointed at by oldPoolPtr. Frees the memory. */
+void destroyThreadPool( ThreadPool *oldPoolPtr ) {
+#ifdef GOL__THREADS
+	oldPoolPtr->stopping = true;
+	pthread_barrier_wait( &(oldPoolPtr->startBarrier) );
+	for ( int t = 1; t < oldPoolPtr->threadCount; ++t ) {
+		pthread_join( oldPoolPtr->workers[t].thread, NULL );
+	}
+	pthread_barrier_destroy( &(oldPoolPtr->startBarrier) );
+	pthread_barrier_destroy( &(oldPoolPtr->doneBarrier) );
+	pthread_mutex_destroy( &(oldPoolPtr->startupLock) );
+	free( oldPoolPtr->workers );
+#endif
+	free( oldPoolPtr );
+}
+
+/* Runs job( argument, threadIndex, threadCount ) once on every thread of the pool, the calling thread being threadIndex 0.
+ * Returns after all threads have finished, so everything the job wrote is visible to the caller. */
+void runThreadPool( ThreadPool *poolPtr, ThreadJob job, void *argument ) {
+	poolPtr->job = job;
+	poolPtr->jobArgument = argument;
+#ifdef GOL__THREADS
+	if ( poolPtr->threadCount > 1 ) {
+		pthread_barrier_wait( &(poolPtr->startBarrier) );
+		job( argument, 0, poolPtr->threadCount );
+		pthread_barrier_wait( &(poolPtr->doneBarrier) );
+	} else {
+		job( argument, 0, 1 );
+	}
+#else
+	job( argument, 0, 1 );
+#endif
+}
+
+/* Returns the number of online CPUs, or 1 if it is unknown. */
+int onlineProcessorCount() {
+	int count = 1;
+#ifdef _WINDOWS
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo( &systemInfo );
+	count = (int) systemInfo.dwNumberOfProcessors;
+#else
+	long online = sysconf( _SC_NPROCESSORS_ONLN );
+	if ( online > 0 ) {
+		count = (int) online;
+	}
+#endif
+	return count;
+}
+
+
+/* Moludo functions */
+
+/* Pseudo-modulo operation. divisor * quotient >= dividend for positive arguments. */
+lldiv_t lldivGreater ( long long dividend, long long divisor ) {
+	lldiv_t greater;
+	lldiv_t normal = lldiv( dividend, divisor );
+	if ( normal.rem == 0) {
+		greater.quot = normal.quot;
+		greater.rem = normal.rem;
+	} else {
+		if ( ( dividend >= 0 && divisor >= 0 ) ||
+			( dividend < 0 && divisor < 0 ) ) {
+			greater.quot = normal.quot + 1;
+			greater.rem = normal.rem - divisor;
+		} else {
+			greater.quot = normal.quot - 1;
+			greater.rem = normal.rem + divisor;	
+		}
+	}
+	return greater;
+};
+
+/* Modulo operation with nonnegative remainder. */
+lldiv_t lldivPositive ( long long dividend, long long divisor ) {
+	lldiv_t positive;
+	lldiv_t normal = lldiv( dividend, divisor );
+	if ( normal.rem >= 0 ) {
+		positive = normal;
+	} else {
+		positive.quot = normal.quot - 1;
+		positive.rem = normal.rem + divisor;
+	}
+	return positive;
+}
+
+
+/* Renderer */
+/* Draws whole frames with ANSI escape sequences: each frame is built in a buffer allocated once and leaves in a single write, the
+ * cursor goes home instead of the screen being cleared, and with changedRowsOnly only the rows that differ are sent again. */
+
+/* Creates a Renderer for Grids of gridSizeX by gridSizeY cells. Returns a pointer to it, if successful. Returns a NULL pointer otherwise. */
+Renderer *createRenderer( long long gridSizeX, long long gridSizeY, PrintOptions *optionsPtr, bool changedRowsOnly ) {
+	Renderer *newRendererPtr = NULL;
+	
+	if ( gridSizeX < 1 || gridSizeY < 1 ) {
+		fprintf( stderr, "ERROR: ( gridSizeX, gridSizeY ) == ( %lld, %lld ) is invalid. A Renderer needs at least one cell.\n", gridSizeX, gridSizeY );
+	} else {
+		size_t cells = (size_t) gridSizeX * (size_t) gridSizeY;
+		newRendererPtr = (Renderer *) malloc( sizeof( Renderer ) );
+		if ( newRendererPtr != NULL ) {
+			newRendererPtr->frame = (char *) malloc( GOL__RENDER__FRAME_OVERHEAD + cells + (size_t) gridSizeX * GOL__RENDER__ROW_OVERHEAD );
+			newRendererPtr->lastRows = (char *) malloc( cells );
+			if ( newRendererPtr->frame == NULL || newRendererPtr->lastRows == NULL ) {
+				free( newRendererPtr->frame );
+				free( newRendererPtr->lastRows );
+				free( newRendererPtr );
+				newRendererPtr = NULL;
+			}
+		}
+		if ( newRendererPtr == NULL ) {
+			fprintf( stderr, "ERROR: Could not allocate memory to render a grid with dimensions %lld by %lld.\n", gridSizeX, gridSizeY );
+		} else {
+			newRendererPtr->gridSizeX = gridSizeX;
+			newRendererPtr->gridSizeY = gridSizeY;
+			newRendererPtr->options = *optionsPtr;
+			newRendererPtr->changedRowsOnly = changedRowsOnly;
+			newRendererPtr->drawn = false;
+		}
+	}
+	
+	return newRendererPtr;
+}
+
+/* Destroys the Renderer pointed at by oldRendererPtr. Frees the memory. */
+void destroyRenderer( Renderer *oldRendererPtr ) {
+	free( oldRendererPtr->frame );
+	free( oldRendererPtr->lastRows );
+	free( oldRendererPtr );
+}
+
+/* Draws the title and the Grid, which must have the size of the Renderer, as one frame to stdout. The first frame clears the screen;
+ * later ones move the cursor home and overwrite it. Returns 0 on success; > 0 on a Grid of the wrong size or a failed write. */
+ErrorChar renderGrid( Renderer *rendererPtr, Grid *gridPtr, const char *title ) {
+	ErrorChar error = 0;
+	
+	if ( gridPtr->gridSizeX != rendererPtr->gridSizeX || gridPtr->gridSizeY != rendererPtr->gridSizeY ) {
+		error = 1;
+		fprintf( stderr, "ERROR: The Grid is %lld by %lld, but the Renderer draws %lld by %lld.\n", gridPtr->gridSizeX, gridPtr->gridSizeY,
+			rendererPtr->gridSizeX, rendererPtr->gridSizeY );
+	} else {
+		size_t sizeY = (size_t) rendererPtr->gridSizeY;
+		char signForOff = rendererPtr->options.signForOff;
+		char signForOn = rendererPtr->options.signForOn;
+		bool fullFrame = rendererPtr->drawn == false || rendererPtr->changedRowsOnly == false;
+		char *end = rendererPtr->frame;
+		
+		/* The title on the first line, cleared to its end; the Grid starts on the third. */
+		end += sprintf( end, fullFrame && rendererPtr->drawn == false ? "\x1b[H\x1b[2J" : "\x1b[H" );
+		size_t titleLength = strnlen( title, GOL__RENDER__TITLE_SIZE - 1 );
+		memcpy( end, title, titleLength );
+		end += titleLength;
+		end += sprintf( end, "\x1b[K\r\n\r\n" );
+		for ( long long x = 0; x < rendererPtr->gridSizeX; ++x ) {
+			const uint64_t *cells = gridPtr->origin[x];
+			char *lastRow = rendererPtr->lastRows + (size_t) x * sizeY;
+			char *row = end + ( fullFrame ? 0 : sprintf( end, "\x1b[%lld;1H", x + 3 ) );
+			for ( size_t y = 0; y < sizeY; ++y ) {
+				row[y] = rowCell( cells, (long long) y ) ? signForOn : signForOff;
+			}
+			if ( fullFrame == true || memcmp( row, lastRow, sizeY ) != 0 ) {
+				memcpy( lastRow, row, sizeY );
+				end = row + sizeY;
+				if ( fullFrame == true ) {
+					*end++ = '\r';
+					*end++ = '\n';
+				}
+			}
+		}
+		if ( writeStandardOutput( rendererPtr->frame, (size_t) ( end - rendererPtr->frame ) ) != 0 ) {
+			error = 2;
+		} else {
+			rendererPtr->drawn = true;
+		}
+	}
+	
+	return error;
+}
+
+/* Renderer - render thread */
+/* The simulation and the display meet in a FrameExchange: a triple buffer of Grid copies. When the render thread asks for a frame, the simulation
+ * thread copies its current Grid into its back copy after the next generation and swaps it with the middle one in one atomic exchange, which also
+ * marks it fresh. The render thread swaps its front copy with a fresh middle copy the same way. Neither ever waits for the other, and the
+ * simulation copies a Grid only once per frame shown. */
+
+/* Copies the cells of srcGridPtr into trgGridPtr, which has the same size; the halo is not copied. */
+static void copyGridCells( Grid *srcGridPtr, Grid *trgGridPtr ) {
+	for ( long long x = 0; x < srcGridPtr->gridSizeX; ++x ) {
+		memcpy( trgGridPtr->origin[x], srcGridPtr->origin[x], srcGridPtr->arraySizeY * sizeof( uint64_t ) );
+	}
+}
+
+#ifdef GOL__THREADS
+/* Copies the Grid of the Game into the back copy and swaps it into the middle, marked fresh. */
+static void publishFrame( FrameExchange *exchangePtr, unsigned long long generation ) {
+	copyGridCells( exchangePtr->gamePtr->currentGridPtr, exchangePtr->gridPtrs[ exchangePtr->back ] );
+	exchangePtr->generations[ exchangePtr->back ] = generation;
+	exchangePtr->back = atomic_exchange_explicit( &(exchangePtr->middle), exchangePtr->back | GOL__EXCHANGE__FRESH, memory_order_acq_rel ) & 3;
+}
+
+/* Main loop of the simulation thread: step the Game, and publish a frame after a generation whenever the renderer asked for one. */
+static void *frameExchangeSimulation( void *argument ) {
+	FrameExchange *exchangePtr = (FrameExchange *) argument;
+	unsigned long long generation = 0;
+	
+	while ( ( exchangePtr->maxGenerations == 0 || generation < exchangePtr->maxGenerations ) &&
+			atomic_load_explicit( &(exchangePtr->stopping), memory_order_relaxed ) == false ) {
+		iterateGame( exchangePtr->gamePtr );
+		++generation;
+		if ( atomic_load_explicit( &(exchangePtr->requested), memory_order_relaxed ) == true ) {
+			atomic_store_explicit( &(exchangePtr->requested), false, memory_order_relaxed );
+			publishFrame( exchangePtr, generation );
+		}
+	}
+	publishFrame( exchangePtr, generation );
+	atomic_store_explicit( &(exchangePtr->finished), true, memory_order_release );
+	
+	return NULL;
+}
+#endif
+
+/* Makes the front copy the latest generation available by the time frameTime. Returns true if that is the last generation.
+ * With GOL__THREADS this takes a fresh middle copy, if there is one; without, the calling thread steps the Game until frameTime. */
+static bool takeLatestFrame( FrameExchange *exchangePtr, double frameTime ) {
+	bool finished = false;
+	
+#ifdef GOL__THREADS
+	(void) frameTime;
+	finished = atomic_load_explicit( &(exchangePtr->finished), memory_order_acquire ); // before the exchange, so that the last frame is taken
+	if ( ( atomic_load_explicit( &(exchangePtr->middle), memory_order_acquire ) & GOL__EXCHANGE__FRESH ) != 0 ) {
+		exchangePtr->front = atomic_exchange_explicit( &(exchangePtr->middle), exchangePtr->front, memory_order_acq_rel ) & 3;
+	}
+#else
+	unsigned long long generation = exchangePtr->generations[ exchangePtr->front ];
+	while ( ( exchangePtr->maxGenerations == 0 || generation < exchangePtr->maxGenerations ) && monotonicSeconds() < frameTime ) {
+		iterateGame( exchangePtr->gamePtr );
+		++generation;
+	}
+	finished = exchangePtr->maxGenerations != 0 && generation >= exchangePtr->maxGenerations;
+	copyGridCells( exchangePtr->gamePtr->currentGridPtr, exchangePtr->gridPtrs[ exchangePtr->front ] );
+	exchangePtr->generations[ exchangePtr->front ] = generation;
+#endif
+	
+	return finished;
+}
+
+/* Steps the Game on a thread of its own for maxGenerations generations (forever for 0) while the calling thread draws the latest finished
+ * generation through a Renderer framesPerSecond times per second. Returns after the last generation is drawn. Without GOL__THREADS the
+ * calling thread alternates between stepping for a frame's time and drawing. Returns 0 on success; > 0 on error. */
+ErrorChar runAndRenderGameLoop( Game *gamePtr, PrintOptions *optionsPtr, unsigned int framesPerSecond, unsigned long long maxGenerations ) {
+	ErrorChar error = 0;
+	
+	Grid *gridPtr = gamePtr->currentGridPtr;
+	Renderer *rendererPtr = createRenderer( gridPtr->gridSizeX, gridPtr->gridSizeY, optionsPtr, true );
+	double framePeriod = 1.0 / ( framesPerSecond > 0 ? framesPerSecond : 1 );
+	char title[GOL__RENDER__TITLE_SIZE];
+	FrameExchange exchange;
+	
+	exchange.gamePtr = gamePtr;
+	exchange.maxGenerations = maxGenerations;
+	exchange.back = 2;
+	exchange.front = 0;
+	for ( int i = 0; i < 3; ++i ) {
+		exchange.gridPtrs[i] = ( rendererPtr == NULL ) ? NULL : createGrid( gridPtr->gridSizeX, gridPtr->gridSizeY, gridPtr->outOfBoundsRule );
+		exchange.generations[i] = 0;
+		error = ( exchange.gridPtrs[i] == NULL ) ? 1 : error;
+	}
+	if ( error != 0 ) {
+		fprintf( stderr, "ERROR: Could not allocate memory to render the game on its own thread.\n" );
+	} else {
+		double start = monotonicSeconds();
+		double nextFrame = start;
+		bool finished = false;
+		copyGridCells( gridPtr, exchange.gridPtrs[ exchange.front ] );
+#ifdef GOL__THREADS
+		pthread_t simulation;
+		atomic_init( &(exchange.middle), 1 );
+		atomic_init( &(exchange.requested), false );
+		atomic_init( &(exchange.finished), false );
+		atomic_init( &(exchange.stopping), false );
+		if ( pthread_create( &simulation, NULL, frameExchangeSimulation, &exchange ) != 0 ) {
+			error = 2;
+			fprintf( stderr, "ERROR: Could not start the simulation thread.\n" );
+		}
+#endif
+		while ( error == 0 && finished == false ) {
+			finished = takeLatestFrame( &exchange, nextFrame );
+			unsigned long long shown = exchange.generations[ exchange.front ];
+			double elapsed = monotonicSeconds() - start;
+			snprintf( title, sizeof( title ), "GAME OF LIFE - generation %llu, %.0f generations/s", shown, elapsed > 0.0 ? (double) shown / elapsed : 0.0 );
+			error = ( renderGrid( rendererPtr, exchange.gridPtrs[ exchange.front ], title ) != 0 ) ? 3 : 0;
+			nextFrame += framePeriod;
+			double now = monotonicSeconds();
+			if ( nextFrame < now ) {
+				nextFrame = now; // skip the frames that are already late rather than rush them
+			}
+#ifdef GOL__THREADS
+			if ( finished == false ) {
+				Sleep( (unsigned int) ( ( nextFrame - now ) * 1000.0 ) );
+				atomic_store_explicit( &(exchange.requested), true, memory_order_relaxed );
+			}
+#endif
+		}
+#ifdef GOL__THREADS
+		if ( error != 2 ) {
+			atomic_store_explicit( &(exchange.stopping), true, memory_order_relaxed );
+			pthread_join( simulation, NULL );
+		}
+#endif
+	}
+	for ( int i = 0; i < 3; ++i ) {
+		if ( exchange.gridPtrs[i] != NULL ) {
+			destroyGrid( exchange.gridPtrs[i] );
+		}
+	}
+	if ( rendererPtr != NULL ) {
+		destroyRenderer( rendererPtr );
+	}
+	
+	return error;
+}
+
+/* Renderer - viewport */
+
+/* Creates a Viewport of rows lines by columns glyphs at zoom 1 on the top left corner of a Grid. Returns a pointer to it, if successful.
+ * Returns a NULL pointer otherwise. */
+Viewport *createViewport( long long rows, long long columns, char glyphs ) {
+	Viewport *newViewportPtr = NULL;
+	
+	if ( rows < 1 || columns < 1 ) {
+		fprintf( stderr, "ERROR: ( rows, columns ) == ( %lld, %lld ) is invalid. A Viewport needs at least one glyph.\n", rows, columns );
+	} else if ( glyphs != GOL__GLYPHS__DENSITY && glyphs != GOL__GLYPHS__HALF_BLOCK && glyphs != GOL__GLYPHS__BRAILLE ) {
+		fprintf( stderr, "ERROR: glyphs == %d is invalid.\n", glyphs );
+	} else {
+		newViewportPtr = (Viewport *) malloc( sizeof( Viewport ) );
+		if ( newViewportPtr != NULL ) {
+			newViewportPtr->originX = 0;
+			newViewportPtr->originY = 0;
+			newViewportPtr->zoom = 1;
+			newViewportPtr->rows = rows;
+			newViewportPtr->columns = columns;
+			newViewportPtr->glyphs = glyphs;
+			newViewportPtr->words = NULL;
+			newViewportPtr->wordCapacity = 0;
+			newViewportPtr->dotCounts = (uint32_t *) malloc( (size_t) columns * 8 * sizeof( uint32_t ) );
+			newViewportPtr->frame = (char *) malloc( GOL__RENDER__FRAME_OVERHEAD + (size_t) rows * ( (size_t) columns * GOL__GLYPHS__UTF8_SIZE + 2 ) );
+			if ( newViewportPtr->dotCounts == NULL || newViewportPtr->frame == NULL || zoomViewport( newViewportPtr, 1 ) != 0 ) {
+				destroyViewport( newViewportPtr );
+				newViewportPtr = NULL;
+			}
+		}
+		if ( newViewportPtr == NULL ) {
+			fprintf( stderr, "ERROR: Could not allocate memory for a viewport of %lld by %lld glyphs.\n", rows, columns );
+		}
+	}
+	
+	return newViewportPtr;
+}
+
+/* Destroys the Viewport pointed at by oldViewportPtr. Frees the memory. */
+void destroyViewport( Viewport *oldViewportPtr ) {
+	free( oldViewportPtr->words == NULL ? NULL : oldViewportPtr->words - 1 );
+	free( oldViewportPtr->dotCounts );
+	free( oldViewportPtr->frame );
+	free( oldViewportPtr );
+}
+
+/* Returns the dots per glyph vertically (dotRows) and horizontally (dotColumns) for the glyphs of a Viewport. */
+static void viewportDots( const Viewport *viewportPtr, long long *dotRowsPtr, long long *dotColumnsPtr ) {
+	*dotRowsPtr = ( viewportPtr->glyphs == GOL__GLYPHS__BRAILLE ) ? 4 : ( viewportPtr->glyphs == GOL__GLYPHS__HALF_BLOCK ) ? 2 : 1;
+	*dotColumnsPtr = ( viewportPtr->glyphs == GOL__GLYPHS__BRAILLE ) ? 2 : 1;
+}
+
+/* Zooms the window so that it shows the whole Grid from its top left corner. */
+void fitViewport( Viewport *viewportPtr, Grid *gridPtr ) {
+	long long dotRows;
+	long long dotColumns;
+	viewportDots( viewportPtr, &dotRows, &dotColumns );
+	long long dotsX = viewportPtr->rows * dotRows;
+	long long dotsY = viewportPtr->columns * dotColumns;
+	long long zoomX = ( gridPtr->gridSizeX + dotsX - 1 ) / dotsX;
+	long long zoomY = ( gridPtr->gridSizeY + dotsY - 1 ) / dotsY;
+	
+	viewportPtr->originX = 0;
+	viewportPtr->originY = 0;
+	zoomViewport( viewportPtr, zoomX > zoomY ? zoomX : zoomY );
+}
+
+/* Moves the window by deltaX cells down and deltaY cells right. */
+void panViewport( Viewport *viewportPtr, long long deltaX, long long deltaY ) {
+	viewportPtr->originX += deltaX;
+	viewportPtr->originY += deltaY;
+}
+
+/* Sets the cells per dot side, keeping the cell in the middle of the window in place. Returns 0 on success; > 0 on an invalid zoom or a failed allocation. */
+ErrorChar zoomViewport( Viewport *viewportPtr, long long zoom ) {
+	ErrorChar error = 0;
+	long long dotRows;
+	long long dotColumns;
+	viewportDots( viewportPtr, &dotRows, &dotColumns );
+	long long dotsX = viewportPtr->rows * dotRows;
+	long long dotsY = viewportPtr->columns * dotColumns;
+	
+	if ( zoom < 1 || zoom > ( 1LL << 32 ) / dotsY ) {
+		error = 1;
+		fprintf( stderr, "ERROR: zoom == %lld is invalid.\n", zoom );
+	} else {
+		/* The packed window spans up to two words more than its width, plus the ghost words on either side. */
+		size_t wordCapacity = (size_t) ( dotsY * zoom ) / GOL__BITBOARD__CELLS_PER_WORD + 2;
+		if ( wordCapacity > viewportPtr->wordCapacity ) {
+			uint64_t *buffer = (uint64_t *) malloc( ( wordCapacity + 2 ) * sizeof( uint64_t ) );
+			if ( buffer == NULL ) {
+				error = 2;
+				fprintf( stderr, "ERROR: Could not allocate memory to zoom the viewport to %lld.\n", zoom );
+			} else {
+				free( viewportPtr->words == NULL ? NULL : viewportPtr->words - 1 );
+				viewportPtr->words = buffer + 1;
+				viewportPtr->wordCapacity = wordCapacity;
+			}
+		}
+		if ( error == 0 && viewportPtr->words != NULL ) {
+			viewportPtr->originX += dotsX * ( viewportPtr->zoom - zoom ) / 2;
+			viewportPtr->originY += dotsY * ( viewportPtr->zoom - zoom ) / 2;
+		}
+		if ( error == 0 ) {
+			viewportPtr->zoom = zoom;
+		}
+	}
+	
+	return error;
+}
+
+/* Returns the number of set bits in columns a .. b - 1 of a packed row whose words[0] starts at column firstColumn. */
+static inline uint32_t packedRangePopulation( const uint64_t *words, long long firstColumn, long long a, long long b ) {
+	uint32_t population = 0;
+	long long firstIndex = ( a - firstColumn ) / GOL__BITBOARD__CELLS_PER_WORD;
+	long long lastIndex = ( b - 1 - firstColumn ) / GOL__BITBOARD__CELLS_PER_WORD;
+	uint64_t firstMask = ~0ULL << ( ( a - firstColumn ) % GOL__BITBOARD__CELLS_PER_WORD );
+	uint64_t lastMask = ~0ULL >> ( 63 - ( b - 1 - firstColumn ) % GOL__BITBOARD__CELLS_PER_WORD );
+	
+	if ( firstIndex == lastIndex ) {
+		population = (uint32_t) __builtin_popcountll( words[firstIndex] & firstMask & lastMask );
+	} else {
+		population = (uint32_t) __builtin_popcountll( words[firstIndex] & firstMask ) + (uint32_t) __builtin_popcountll( words[lastIndex] & lastMask );
+		for ( long long k = firstIndex + 1; k < lastIndex; ++k ) {
+			population += (uint32_t) __builtin_popcountll( words[k] );
+		}
+	}
+	
+	return population;
+}
+
+/* Draws the title and the window of the Grid as one frame to stdout, like renderGrid. Each dot counts the live cells of its block with popcount on
+ * packed rows, so a frame costs the cells in the window divided by 64 plus the glyphs; cells outside the Grid count as dead. With density glyphs,
+ * a glyph shows the share of live cells in its block; with half blocks and braille, a dot is lit if its block has any live cell.
+ * Returns 0 on success; > 0 on a failed write. */
+ErrorChar renderViewport( Viewport *viewportPtr, Grid *gridPtr, const char *title ) {
+	ErrorChar error = 0;
+	
+	static const unsigned char brailleBits[4][2] = { { 0x01, 0x08 }, { 0x02, 0x10 }, { 0x04, 0x20 }, { 0x40, 0x80 } };
+	const char *ramp = GOL__GLYPHS__RAMP;
+	long long rampLevels = (long long) strlen( ramp ) - 1;
+	long long zoom = viewportPtr->zoom;
+	long long dotRows;
+	long long dotColumns;
+	viewportDots( viewportPtr, &dotRows, &dotColumns );
+	long long dotsY = viewportPtr->columns * dotColumns;
+	/* The columns of the window that lie in the Grid, and the packed words that hold them. */
+	long long firstY = viewportPtr->originY > 0 ? viewportPtr->originY : 0;
+	long long endY = viewportPtr->originY + dotsY * zoom < gridPtr->gridSizeY ? viewportPtr->originY + dotsY * zoom : gridPtr->gridSizeY;
+	size_t firstWord = (size_t) ( firstY / GOL__BITBOARD__CELLS_PER_WORD );
+	size_t wordCount = firstY < endY ? (size_t) ( ( endY - 1 ) / GOL__BITBOARD__CELLS_PER_WORD ) - firstWord + 1 : 0;
+	long long firstColumn = (long long) firstWord * GOL__BITBOARD__CELLS_PER_WORD;
+	char *end = viewportPtr->frame;
+	
+	end += sprintf( end, "\x1b[H" );
+	size_t titleLength = strnlen( title, GOL__RENDER__TITLE_SIZE - 1 );
+	memcpy( end, title, titleLength );
+	end += titleLength;
+	end += sprintf( end, "\x1b[K\r\n" );
+	for ( long long line = 0; line < viewportPtr->rows; ++line ) {
+		memset( viewportPtr->dotCounts, 0, (size_t) ( dotRows * dotsY ) * sizeof( uint32_t ) );
+		for ( long long dotRow = 0; dotRow < dotRows && wordCount > 0; ++dotRow ) {
+			uint32_t *counts = viewportPtr->dotCounts + dotRow * dotsY;
+			long long firstX = viewportPtr->originX + ( line * dotRows + dotRow ) * zoom;
+			for ( long long x = firstX > 0 ? firstX : 0; x < firstX + zoom && x < gridPtr->gridSizeX; ++x ) {
+				packGridRow( gridPtr, x, firstWord, wordCount, viewportPtr->words );
+				for ( long long dot = 0; dot < dotsY; ++dot ) {
+					long long a = viewportPtr->originY + dot * zoom;
+					long long b = a + zoom;
+					a = a > firstY ? a : firstY;
+					b = b < endY ? b : endY;
+					if ( a < b ) {
+						counts[dot] += packedRangePopulation( viewportPtr->words, firstColumn, a, b );
+					}
+				}
+			}
+		}
+		for ( long long column = 0; column < viewportPtr->columns; ++column ) {
+			const uint32_t *counts = viewportPtr->dotCounts;
+			if ( viewportPtr->glyphs == GOL__GLYPHS__DENSITY ) {
+				long long count = counts[column];
+				*end++ = ramp[ count == 0 ? 0 : 1 + ( count * ( rampLevels - 1 ) ) / ( zoom * zoom ) ];
+			} else if ( viewportPtr->glyphs == GOL__GLYPHS__HALF_BLOCK ) {
+				int shape = ( counts[column] != 0 ) | ( counts[ dotsY + column ] != 0 ) << 1;
+				if ( shape == 0 ) {
+					*end++ = ' ';
+				} else {
+					/* U+2580 upper half, U+2584 lower half, U+2588 full block */
+					*end++ = (char) 0xE2;
+					*end++ = (char) 0x96;
+					*end++ = (char) ( shape == 1 ? 0x80 : shape == 2 ? 0x84 : 0x88 );
+				}
+			} else {
+				unsigned int pattern = 0;
+				for ( long long dotRow = 0; dotRow < 4; ++dotRow ) {
+					for ( long long dotColumn = 0; dotColumn < 2; ++dotColumn ) {
+						pattern |= counts[ dotRow * dotsY + column * 2 + dotColumn ] != 0 ? brailleBits[dotRow][dotColumn] : 0;
+					}
+				}
+				/* U+2800 + pattern */
+				*end++ = (char) 0xE2;
+				*end++ = (char) ( 0xA0 | ( pattern >> 6 ) );
+				*end++ = (char) ( 0x80 | ( pattern & 0x3F ) );
+			}
+		}
+		*end++ = '\r';
+		*end++ = '\n';
+	}
+	if ( writeStandardOutput( viewportPtr->frame, (size_t) ( end - viewportPtr->frame ) ) != 0 ) {
+		error = 1;
+	}
+	
+	return error;
+}
+
+/* Pattern files - RLE */
+/* Run length encoded patterns: an optional block of # comment lines, a header "x = width, y = height, rule = B3/S23", then runs like
+ * "3o2b$" where b is a dead cell, o (or any other letter) a live one, $ ends a row and ! ends the pattern, each with an optional count.
+ * The body streams through a fixed buffer, one packed row at a time, so patterns of any file size load in one pass over the bytes. */
+
+/* Returns the next byte of the stream, or EOF at its end. */
+static inline int nextRleChar( RleReader *readerPtr ) {
+	if ( readerPtr->position == readerPtr->length ) {
+		readerPtr->length = fread( readerPtr->buffer, 1, GOL__RLE__BUFFER_SIZE, readerPtr->stream );
+		readerPtr->position = 0;
+	}
+	
+	return ( readerPtr->position < readerPtr->length ) ? (unsigned char) readerPtr->buffer[ readerPtr->position++ ] : EOF;
+}
+
+/* Skips the comment lines and parses the header line into the pattern size and the rule (Conway's if there is none). Returns 0 on success; > 0 on error. */
+static ErrorChar readRleHeader( RleReader *readerPtr, long long *widthPtr, long long *heightPtr, Rule *rulePtr ) {
+	ErrorChar error = 0;
+	
+	char line[GOL__RLE__HEADER_SIZE];
+	size_t length = 0;
+	int c = nextRleChar( readerPtr );
+	
+	/* Comment lines and blank lines up to the header */
+	while ( c == '#' || c == '\n' || c == '\r' ) {
+		bool comment = c == '#';
+		while ( comment == true && c != '\n' && c != EOF ) {
+			c = nextRleChar( readerPtr );
+		}
+		c = nextRleChar( readerPtr );
+	}
+	for ( ; c != '\n' && c != EOF && error == 0; c = nextRleChar( readerPtr ) ) {
+		if ( length + 1 == sizeof( line ) ) {
+			error = 1;
+		} else if ( c != ' ' && c != '\t' && c != '\r' ) {
+			line[ length++ ] = (char) c;
+		}
+	}
+	line[length] = '\0';
+	*widthPtr = -1;
+	*heightPtr = -1;
+	parseRule( "B3/S23", rulePtr );
+	/* Without blanks the header reads "x=width,y=height,rule=notation". */
+	for ( char *key = line; error == 0 && *key != '\0'; ) {
+		char *value = strchr( key, '=' );
+		char *next = ( value == NULL ) ? NULL : strchr( value, ',' );
+		if ( value == NULL ) {
+			error = 1;
+		} else {
+			*value++ = '\0';
+			if ( next != NULL ) {
+				*next++ = '\0';
+			}
+			if ( strcmp( key, "x" ) == 0 || strcmp( key, "y" ) == 0 ) {
+				char *end;
+				long long size = strtoll( value, &end, 10 );
+				error = ( *end != '\0' || size < 1 ) ? 1 : 0;
+				*( key[0] == 'x' ? widthPtr : heightPtr ) = size;
+			} else if ( strcmp( key, "rule" ) == 0 ) {
+				char *topology = strchr( value, ':' ); // Golly's bounded grid suffix, e.g. ":T100,100"; the Game has its own outOfBoundsRule
+				if ( topology != NULL ) {
+					*topology = '\0';
+				}
+				error = parseRule( value, rulePtr );
+			}
+			key = ( next == NULL ) ? value + strlen( value ) : next;
+		}
+	}
+	if ( error == 0 && ( *widthPtr < 1 || *heightPtr < 1 ) ) {
+		error = 1;
+	}
+	if ( error != 0 ) {
+		fprintf( stderr, "ERROR: Invalid RLE header. Expected \"x = <width>, y = <height>, rule = <B/S notation>\".\n" );
+	}
+	
+	return error;
+}
+
+/* Sets columns a .. b - 1 of a packed row whose words[0] starts at column firstColumn. */
+static inline void setPackedRange( uint64_t *words, long long firstColumn, long long a, long long b ) {
+	long long firstIndex = ( a - firstColumn ) / GOL__BITBOARD__CELLS_PER_WORD;
+	long long lastIndex = ( b - 1 - firstColumn ) / GOL__BITBOARD__CELLS_PER_WORD;
+	uint64_t firstMask = ~0ULL << ( ( a - firstColumn ) % GOL__BITBOARD__CELLS_PER_WORD );
+	uint64_t lastMask = ~0ULL >> ( 63 - ( b - 1 - firstColumn ) % GOL__BITBOARD__CELLS_PER_WORD );
+	
+	if ( firstIndex == lastIndex ) {
+		words[firstIndex] |= firstMask & lastMask;
+	} else {
+		words[firstIndex] |= firstMask;
+		for ( long long k = firstIndex + 1; k < lastIndex; ++k ) {
+			words[k] = ~0ULL;
+		}
+		words[lastIndex] |= lastMask;
+	}
+}
+
+/* Parses the runs of a pattern of width by height cells and sets its live cells in the Grid, with the top left corner at ( originX, originY ).
+ * The rows the pattern touches are packed, their live runs set with word masks, and unpacked again. Returns 0 on success; > 0 on error. */
+static ErrorChar readRleBody( RleReader *readerPtr, Grid *gridPtr, long long originX, long long originY, long long width, long long height ) {
+	ErrorChar error = 0;
+	
+	size_t firstWord = (size_t) ( originY / GOL__BITBOARD__CELLS_PER_WORD );
+	size_t wordCount = (size_t) ( ( originY + width - 1 ) / GOL__BITBOARD__CELLS_PER_WORD ) - firstWord + 1;
+	long long firstColumn = (long long) firstWord * GOL__BITBOARD__CELLS_PER_WORD;
+	uint64_t *buffer = (uint64_t *) malloc( ( wordCount + 2 ) * sizeof( uint64_t ) );
+	uint64_t *words = buffer + 1;
+	long long x = 0;
+	long long y = 0;
+	long long count = 0;
+	bool rowTouched = false;
+	bool done = false;
+	
+	if ( buffer == NULL ) {
+		error = 1;
+		fprintf( stderr, "ERROR: Could not allocate memory to read an RLE pattern %lld cells wide.\n", width );
+	}
+	while ( error == 0 && done == false ) {
+		int c = nextRleChar( readerPtr );
+		long long run = ( count > 0 ) ? count : 1;
+		if ( c >= '0' && c <= '9' ) {
+			if ( count > ( LLONG_MAX - ( c - '0' ) ) / 10 ) {
+				error = 2;
+			} else {
+				count = count * 10 + ( c - '0' );
+			}
+			continue;
+		}
+		/* Every run is checked against the pattern size before it is added, so neither x nor y can overflow. */
+		if ( c == 'b' || c == '.' ) {
+			if ( run > width - y ) {
+				error = 2;
+			} else {
+				y += run;
+			}
+		} else if ( ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' ) ) {
+			if ( x >= height || run > width - y ) {
+				error = 2;
+			} else {
+				if ( rowTouched == false ) {
+					packGridRow( gridPtr, originX + x, firstWord, wordCount, words );
+					rowTouched = true;
+				}
+				setPackedRange( words, firstColumn, originY + y, originY + y + run );
+				y += run;
+			}
+		} else if ( c == '$' || c == '!' || c == EOF ) {
+			if ( rowTouched == true ) {
+				unpackGridRow( gridPtr, originX + x, firstWord, wordCount, words );
+				rowTouched = false;
+			}
+			if ( c != '$' ) {
+				done = true;
+			} else if ( run > height - x ) {
+				error = 2;
+			} else {
+				x += run;
+				y = 0;
+			}
+		} else if ( c != ' ' && c != '\t' && c != '\r' && c != '\n' ) {
+			error = 2;
+		}
+		count = 0;
+	}
+	if ( error == 2 ) {
+		fprintf( stderr, "ERROR: Invalid RLE body in row %lld: unexpected character, or cells outside the %lld by %lld pattern.\n", x, width, height );
+	}
+	free( buffer );
+	
+	return error;
+}
+
+/* Reads an RLE pattern from the stream into a new Game of its size and rule. Returns a pointer to it, if successful. Returns a NULL pointer otherwise. */
+Game *readGameRle( FILE *stream, char outOfBoundsRule ) {
+	Game *newGamePtr = NULL;
+	
+	RleReader *readerPtr = (RleReader *) malloc( sizeof( RleReader ) );
+	long long width;
+	long long height;
+	Rule rule;
+	
+	if ( readerPtr == NULL ) {
+		fprintf( stderr, "ERROR: Could not allocate memory to read an RLE pattern.\n" );
+	} else {
+		readerPtr->stream = stream;
+		readerPtr->length = 0;
+		readerPtr->position = 0;
+		if ( readRleHeader( readerPtr, &width, &height, &rule ) == 0 ) {
+			newGamePtr = createGame( height, width, outOfBoundsRule );
+		}
+		if ( newGamePtr != NULL ) {
+			newGamePtr->rule = rule;
+			if ( readRleBody( readerPtr, newGamePtr->currentGridPtr, 0, 0, width, height ) != 0 ) {
+				destroyGame( newGamePtr );
+				newGamePtr = NULL;
+			}
+		}
+		free( readerPtr );
+	}
+	
+	return newGamePtr;
+}
+
+/* Reads an RLE pattern from the stream and sets its live cells in the current Grid of the Game, with its top left corner at ( originX, originY ).
+ * Other cells keep their state, and so does the Game's rule. Returns 0 on success; > 0 on error or if the pattern does not fit. */
+ErrorChar readRlePattern( FILE *stream, Game *gamePtr, long long originX, long long originY ) {
+	ErrorChar error = 0;
+	
+	Grid *gridPtr = gamePtr->currentGridPtr;
+	RleReader *readerPtr = (RleReader *) malloc( sizeof( RleReader ) );
+	long long width;
+	long long height;
+	Rule rule;
+	
+	if ( readerPtr == NULL ) {
+		error = 1;
+		fprintf( stderr, "ERROR: Could not allocate memory to read an RLE pattern.\n" );
+	} else {
+		readerPtr->stream = stream;
+		readerPtr->length = 0;
+		readerPtr->position = 0;
+		error = readRleHeader( readerPtr, &width, &height, &rule );
+		if ( error == 0 && ( originX < 0 || originY < 0 || height > gridPtr->gridSizeX - originX || width > gridPtr->gridSizeY - originY ) ) {
+			error = 2;
+			fprintf( stderr, "ERROR: An RLE pattern of %lld by %lld cells at ( %lld, %lld ) does not fit into the Grid.\n", height, width, originX, originY );
+		}
+		if ( error == 0 ) {
+			finishGameSnapshot( gamePtr );
+			error = readRleBody( readerPtr, gridPtr, originX, originY, width, height );
+			invalidateGameActivity( gamePtr );
+		}
+		free( readerPtr );
+	}
+	
+	return error;
+}
+
+/* Returns the first column >= y of the packed row ( rowWords words ) whose bit equals state, or rowWords * 64 if there is none. */
+static inline long long nextPackedColumn( const uint64_t *words, size_t rowWords, long long y, bool state ) {
+	size_t k = (size_t) ( y / GOL__BITBOARD__CELLS_PER_WORD );
+	uint64_t word = ( k < rowWords ) ? ( ( state ? words[k] : ~words[k] ) & ( ~0ULL << ( y % GOL__BITBOARD__CELLS_PER_WORD ) ) ) : 0;
+	
+	while ( word == 0 && ++k < rowWords ) {
+		word = state ? words[k] : ~words[k];
+	}
+	
+	return ( k < rowWords ) ? (long long) ( k * GOL__BITBOARD__CELLS_PER_WORD ) + __builtin_ctzll( word ) : (long long) ( rowWords * GOL__BITBOARD__CELLS_PER_WORD );
+}
+
+/* Appends one run as "<count><tag>", the count left out for 1, and breaks the line before it would exceed GOL__RLE__LINE_LENGTH.
+ * The buffer goes to the stream whenever it is nearly full. */
+static void writeRleRun( RleWriter *writerPtr, long long count, char tag ) {
+	char digits[24];
+	int length = 0;
+	
+	for ( ; count > 1 || ( length > 0 && count > 0 ); count /= 10 ) {
+		digits[ length++ ] = (char) ( '0' + count % 10 );
+	}
+	if ( writerPtr->length + sizeof( digits ) + 2 > GOL__RLE__BUFFER_SIZE ) {
+		fwrite( writerPtr->buffer, 1, writerPtr->length, writerPtr->stream );
+		writerPtr->length = 0;
+	}
+	if ( writerPtr->lineLength + length + 1 > GOL__RLE__LINE_LENGTH ) {
+		writerPtr->buffer[ writerPtr->length++ ] = '\n';
+		writerPtr->lineLength = 0;
+	}
+	writerPtr->lineLength += length + 1;
+	while ( length > 0 ) {
+		writerPtr->buffer[ writerPtr->length++ ] = digits[ --length ];
+	}
+	writerPtr->buffer[ writerPtr->length++ ] = tag;
+}
+
+/* Writes the current Grid and the rule of the Game to the stream as an RLE pattern. Runs are found a word at a time in packed rows;
+ * dead cells at the end of a row and empty rows at the end are left out. Returns 0 on success; > 0 on error. */
+ErrorChar writeGameRle( FILE *stream, Game *gamePtr ) {
+	ErrorChar error = 0;
+	
+	Grid *gridPtr = gamePtr->currentGridPtr;
+	size_t rowWords = bitboardRowWords( gridPtr );
+	uint64_t *buffer = (uint64_t *) malloc( ( rowWords + 2 ) * sizeof( uint64_t ) );
+	uint64_t *words = buffer + 1;
+	RleWriter *writerPtr = (RleWriter *) malloc( sizeof( RleWriter ) );
+	char notation[GOL__RULE__NOTATION_SIZE];
+	long long pendingRows = 0;
+	
+	if ( buffer == NULL || writerPtr == NULL ) {
+		error = 1;
+		fprintf( stderr, "ERROR: Could not allocate memory to write an RLE pattern.\n" );
+	} else {
+		writerPtr->stream = stream;
+		writerPtr->length = 0;
+		writerPtr->lineLength = 0;
+		formatRule( &(gamePtr->rule), notation );
+		fprintf( stream, "x = %lld, y = %lld, rule = %s\n", gridPtr->gridSizeY, gridPtr->gridSizeX, notation );
+		for ( long long x = 0; x < gridPtr->gridSizeX; ++x ) {
+			long long y = 0;
+			packGridRow( gridPtr, x, 0, rowWords, words );
+			words[ rowWords - 1 ] &= ~( ~0ULL << ( gridPtr->gridSizeY % GOL__BITBOARD__CELLS_PER_WORD ) ); // drop the ghost cell in column gridSizeY
+			for ( long long alive = nextPackedColumn( words, rowWords, 0, true ); alive < gridPtr->gridSizeY; alive = nextPackedColumn( words, rowWords, y, true ) ) {
+				long long dead = nextPackedColumn( words, rowWords, alive, false );
+				if ( pendingRows > 0 ) {
+					writeRleRun( writerPtr, pendingRows, '$' );
+					pendingRows = 0;
+				}
+				if ( alive > y ) {
+					writeRleRun( writerPtr, alive - y, 'b' );
+				}
+				writeRleRun( writerPtr, dead - alive, 'o' );
+				y = dead;
+			}
+			++pendingRows;
+		}
+		writeRleRun( writerPtr, 1, '!' );
+		writerPtr->buffer[ writerPtr->length++ ] = '\n';
+		if ( fwrite( writerPtr->buffer, 1, writerPtr->length, stream ) != writerPtr->length || ferror( stream ) ) {
+			error = 2;
+			fprintf( stderr, "ERROR: Could not write the RLE pattern.\n" );
+		}
+	}
+	free( buffer );
+	free( writerPtr );
+	
+	return error;
+}
+
+/* Reads the RLE file at path into a new Game, see readGameRle. Returns a pointer to it, if successful. Returns a NULL pointer otherwise. */
+Game *loadGameRle( const char *path, char outOfBoundsRule ) {
+	Game *newGamePtr = NULL;
+	
+	FILE *stream = fopen( path, "rb" );
+	
+	if ( stream == NULL ) {
+		fprintf( stderr, "ERROR: Could not open \"%s\".\n", path );
+	} else {
+		newGamePtr = readGameRle( stream, outOfBoundsRule );
+		fclose( stream );
+	}
+	
+	return newGamePtr;
+}
+
+/* Writes the Game to an RLE file at path, see writeGameRle. Returns 0 on success; > 0 on error. */
+ErrorChar saveGameRle( Game *gamePtr, const char *path ) {
+	ErrorChar error = 0;
+	
+	FILE *stream = fopen( path, "wb" );
+	
+	if ( stream == NULL ) {
+		error = 1;
+		fprintf( stderr, "ERROR: Could not open \"%s\".\n", path );
+	} else {
+		error = writeGameRle( stream, gamePtr );
+		if ( fclose( stream ) != 0 && error == 0 ) {
+			error = 2;
+			fprintf( stderr, "ERROR: Could not write \"%s\".\n", path );
+		}
+	}
+	
+	return error;
+}
+
+/* Snapshots */
+/* A snapshot file is a SnapshotHeader, zeros up to payloadOffset, and the payload: rows -1 .. gridSizeX of the Grid, rowStride bytes each,
+ * with word 0 of a packed row GOL__GRID__ROW_OFFSET bytes into it, in the byte order of the machine. That is the layout of GOL__STORAGE__CONTIGUOUS,
+ * so a loaded snapshot is a private mapping of the file that the Game reads and copies on write. Ghost cells and padding are saved as 0;
+ * fillGridHalo restores the halo before the next generation. Saving reads only the rows of the Grid, so the Game may keep stepping into its
+ * other Grid meanwhile; refilling the halo rewrites no more than the ghost bits, and those are cleared in the copy. */
+
+/* Continues checksum over length bytes, a multiple of 32: four multiply-xor lanes of 64 bits, folded into one. */
+static uint64_t snapshotChecksum( uint64_t checksum, const char *bytes, size_t length ) {
+	uint64_t lanes[4] = { checksum, checksum ^ 0x9E3779B97F4A7C15ULL, checksum ^ 0xBF58476D1CE4E5B9ULL, checksum ^ 0x94D049BB133111EBULL };
+	
+	for ( size_t i = 0; i + 32 <= length; i += 32 ) {
+		for ( int lane = 0; lane < 4; ++lane ) {
+			uint64_t word;
+			memcpy( &word, bytes + i + (size_t) lane * 8, sizeof( word ) );
+			lanes[lane] = ( lanes[lane] ^ word ) * 0x9E3779B97F4A7C15ULL;
+			lanes[lane] ^= lanes[lane] >> 29;
+		}
+	}
+	checksum = lanes[0] ^ ( lanes[1] << 16 | lanes[1] >> 48 ) ^ ( lanes[2] << 32 | lanes[2] >> 32 ) ^ ( lanes[3] << 48 | lanes[3] >> 16 );
+	checksum *= 0xBF58476D1CE4E5B9ULL;
+	
+	return checksum ^ ( checksum >> 31 );
+}
+
+/* Writes the header, the padding and the payload of the job to its stream, then the header again with the checksum, and closes the stream.
+ * Every row is copied into a buffer first, so only the cells of the Grid are read. Returns 0 on success; > 0 on error. */
+static ErrorChar writeSnapshot( SnapshotJob *jobPtr ) {
+	ErrorChar error = 0;
+	
+	Grid *gridPtr = jobPtr->gridPtr;
+	SnapshotHeader *headerPtr = &(jobPtr->header);
+	size_t rowStride = (size_t) headerPtr->rowStride;
+	char *row = (char *) calloc( rowStride > GOL__SNAPSHOT__ALIGNMENT ? rowStride : GOL__SNAPSHOT__ALIGNMENT, 1 );
+	uint64_t checksum = 0;
+	
+	if ( row == NULL ) {
+		error = 1;
+	} else {
+		/* The header with checksum 0, then zeros up to the payload. */
+		memcpy( row, headerPtr, sizeof( SnapshotHeader ) );
+		if ( fwrite( row, 1, (size_t) headerPtr->payloadOffset, jobPtr->stream ) != headerPtr->payloadOffset ) {
+			error = 2;
+		}
+		memset( row, 0, rowStride );
+		for ( long long x = -1; error == 0 && x <= gridPtr->gridSizeX; ++x ) {
+			if ( x >= 0 && x < gridPtr->gridSizeX ) {
+				uint64_t *words = (uint64_t *) ( row + GOL__GRID__ROW_OFFSET );
+				memcpy( words, gridPtr->origin[x], gridPtr->arraySizeY * sizeof( uint64_t ) );
+				words[ gridPtr->arraySizeY - 1 ] &= ( 1ULL << ( gridPtr->gridSizeY % GOL__BITBOARD__CELLS_PER_WORD ) ) - 1; // without the ghost cell
+			} else {
+				memset( row + GOL__GRID__ROW_OFFSET, 0, gridPtr->arraySizeY * sizeof( uint64_t ) );
+			}
+			checksum = snapshotChecksum( checksum, row, rowStride );
+			if ( fwrite( row, 1, rowStride, jobPtr->stream ) != rowStride ) {
+				error = 2;
+			}
+		}
+		headerPtr->checksum = checksum;
+		if ( error == 0 && ( fseek( jobPtr->stream, 0, SEEK_SET ) != 0 || fwrite( headerPtr, sizeof( SnapshotHeader ), 1, jobPtr->stream ) != 1 ) ) {
+			error = 2;
+		}
+		free( row );
+	}
+	if ( fclose( jobPtr->stream ) != 0 && error == 0 ) {
+		error = 2;
+	}
+	
+	return error;
+}
+
+#ifdef GOL__THREADS
+/* Main function of the thread of startGameSnapshot. */
+static void *snapshotThread( void *argument ) {
+	SnapshotJob *jobPtr = (SnapshotJob *) argument;
+	
+	jobPtr->error = writeSnapshot( jobPtr );
+	
+	return NULL;
+}
+#endif
+
+/* Starts saving the current Grid of the Game, its Rule and generation to a snapshot file at path, on a thread of its own with GOL__THREADS.
+ * The Game may keep iterating meanwhile: the next generation goes into the other Grid, and the one after waits for the save to finish.
+ * Writing to the saved Grid directly needs finishGameSnapshot first; the Game's own functions call it themselves.
+ * Returns 0 if the save started; > 0 if the file could not be opened or a save could not be started. */
+ErrorChar startGameSnapshot( Game *gamePtr, const char *path ) {
+	ErrorChar error = 0;
+	
+	Grid *gridPtr = gamePtr->currentGridPtr;
+	SnapshotJob *jobPtr = NULL;
+	
+	finishGameSnapshot( gamePtr );
+	jobPtr = (SnapshotJob *) malloc( sizeof( SnapshotJob ) );
+	if ( jobPtr == NULL ) {
+		error = 1;
+		fprintf( stderr, "ERROR: Could not allocate memory to save a snapshot.\n" );
+	} else if ( ( jobPtr->stream = fopen( path, "wb" ) ) == NULL ) {
+		error = 2;
+		fprintf( stderr, "ERROR: Could not open \"%s\".\n", path );
+		free( jobPtr );
+	} else {
+		SnapshotHeader *headerPtr = &(jobPtr->header);
+		memset( headerPtr, 0, sizeof( SnapshotHeader ) );
+		memcpy( headerPtr->magic, GOL__SNAPSHOT__MAGIC, sizeof( headerPtr->magic ) );
+		headerPtr->version = GOL__SNAPSHOT__VERSION;
+		headerPtr->headerSize = sizeof( SnapshotHeader );
+		headerPtr->gridSizeX = gridPtr->gridSizeX;
+		headerPtr->gridSizeY = gridPtr->gridSizeY;
+		headerPtr->rowStride = gridPtr->rowStride;
+		headerPtr->payloadOffset = GOL__SNAPSHOT__ALIGNMENT;
+		headerPtr->payloadSize = (uint64_t) ( gridPtr->arraySizeX + 2 ) * gridPtr->rowStride;
+		headerPtr->generation = gamePtr->generation;
+		headerPtr->birth = gamePtr->rule.birth;
+		headerPtr->survival = gamePtr->rule.survival;
+		headerPtr->outOfBoundsRule = (uint8_t) gridPtr->outOfBoundsRule;
+		jobPtr->gridPtr = gridPtr;
+		jobPtr->error = 0;
+		gamePtr->snapshotJobPtr = jobPtr;
+#ifdef GOL__THREADS
+		if ( pthread_create( &(jobPtr->thread), NULL, snapshotThread, jobPtr ) != 0 ) {
+			jobPtr->error = writeSnapshot( jobPtr ); // no thread: save right away
+			jobPtr->gridPtr = NULL;
+		}
+#else
+		jobPtr->error = writeSnapshot( jobPtr );
+		jobPtr->gridPtr = NULL;
+#endif
+	}
+	
+	return error;
+}
+
+/* Waits for the snapshot started by startGameSnapshot, if there is one. Returns 0 on success or without a snapshot; > 0 if the save failed. */
+ErrorChar finishGameSnapshot( Game *gamePtr ) {
+	ErrorChar error = 0;
+	
+	SnapshotJob *jobPtr = gamePtr->snapshotJobPtr;
+	
+	if ( jobPtr != NULL ) {
+#ifdef GOL__THREADS
+		if ( jobPtr->gridPtr != NULL ) {
+			pthread_join( jobPtr->thread, NULL );
+		}
+#endif
+		error = jobPtr->error;
+		if ( error != 0 ) {
+			fprintf( stderr, "ERROR: Could not write the snapshot of generation %llu.\n", (unsigned long long) jobPtr->header.generation );
+		}
+		free( jobPtr );
+		gamePtr->snapshotJobPtr = NULL;
+	}
+	
+	return error;
+}
+
+/* Saves the current Grid of the Game, its Rule and generation to a snapshot file at path and waits for it. Returns 0 on success; > 0 on error. */
+ErrorChar saveGameSnapshot( Game *gamePtr, const char *path ) {
+	ErrorChar error = startGameSnapshot( gamePtr, path );
+	
+	if ( error == 0 ) {
+		error = finishGameSnapshot( gamePtr );
+	}
+	
+	return error;
+}
+
+/* Checks a snapshot header against itself and the file size. Returns 0 if it is valid; > 0 otherwise. */
+static ErrorChar checkSnapshotHeader( const SnapshotHeader *headerPtr, unsigned long long fileSize ) {
+	ErrorChar error = 0;
+	
+	if ( memcmp( headerPtr->magic, GOL__SNAPSHOT__MAGIC, sizeof( headerPtr->magic ) ) != 0 ) {
+		error = 1;
+	} else if ( headerPtr->version != GOL__SNAPSHOT__VERSION || headerPtr->headerSize != sizeof( SnapshotHeader ) ) {
+		error = 2;
+	} else if ( headerPtr->gridSizeX < 0 || headerPtr->gridSizeY < 0 || headerPtr->rowStride % GOL__GRID__ALIGNMENT != 0 ||
+			headerPtr->rowStride < GOL__GRID__ROW_OFFSET + ( (uint64_t) headerPtr->gridSizeY / GOL__BITBOARD__CELLS_PER_WORD + 2 ) * sizeof( uint64_t ) ||
+			(uint64_t) headerPtr->gridSizeX + 2 > UINT64_MAX / headerPtr->rowStride ||
+			headerPtr->payloadSize != ( (uint64_t) headerPtr->gridSizeX + 2 ) * headerPtr->rowStride ||
+			headerPtr->payloadOffset % GOL__SNAPSHOT__ALIGNMENT != 0 || headerPtr->payloadOffset < sizeof( SnapshotHeader ) ||
+			headerPtr->payloadOffset > fileSize || headerPtr->payloadSize > fileSize - headerPtr->payloadOffset || // so that the sum below cannot wrap
+			headerPtr->payloadOffset + headerPtr->payloadSize > SIZE_MAX ||
+			headerPtr->birth > 0x1FF || headerPtr->survival > 0x1FF || headerPtr->outOfBoundsRule > GOL__OOBR__TORUS ) {
+		error = 3;
+	}
+	
+	return error;
+}
+
+/* Loads a snapshot file into a new Game with the saved Grid, Rule and generation, and the default engine. Its current Grid is a private mapping
+ * of the file: pages are read when first touched and copied when first written, and the file never changes. With verify, the checksum of the
+ * payload is checked first, which reads the whole file. Without mmap (on Windows), the rows are read into a contiguous Grid instead.
+ * Returns a pointer to the Game, if successful. Returns a NULL pointer otherwise. */
+Game *loadGameSnapshot( const char *path, bool verify ) {
+	Game *newGamePtr = NULL;
+	
+	SnapshotHeader header;
+	unsigned long long fileSize = 0;
+	ErrorChar error = 0;
+	char *payload = NULL;
+	size_t mappingSize = 0;
+	
+#ifdef _WINDOWS
+	FILE *stream = fopen( path, "rb" );
+	if ( stream == NULL || fread( &header, sizeof( header ), 1, stream ) != 1 || _fseeki64( stream, 0, SEEK_END ) != 0 ) {
+		error = 1;
+	} else {
+		fileSize = (unsigned long long) _ftelli64( stream );
+		error = checkSnapshotHeader( &header, fileSize );
+	}
+	if ( error == 0 ) {
+		payload = (char *) malloc( (size_t) header.payloadSize );
+		if ( payload == NULL || _fseeki64( stream, (long long) header.payloadOffset, SEEK_SET ) != 0 ||
+				fread( payload, 1, (size_t) header.payloadSize, stream ) != header.payloadSize ) {
+			error = 4;
+		}
+	}
+	if ( stream != NULL ) {
+		fclose( stream );
+	}
+#else
+	int fileDescriptor = open( path, O_RDONLY );
+	struct stat status;
+	void *mapping = MAP_FAILED;
+	if ( fileDescriptor < 0 || fstat( fileDescriptor, &status ) != 0 || pread( fileDescriptor, &header, sizeof( header ), 0 ) != (ssize_t) sizeof( header ) ) {
+		error = 1;
+	} else {
+		fileSize = (unsigned long long) status.st_size;
+		error = checkSnapshotHeader( &header, fileSize );
+	}
+	if ( error == 0 ) {
+		mappingSize = (size_t) ( header.payloadOffset + header.payloadSize );
+		mapping = mmap( NULL, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDescriptor, 0 );
+		if ( mapping == MAP_FAILED ) {
+			error = 4;
+		} else {
+			payload = (char *) mapping + header.payloadOffset;
+		}
+	}
+	if ( fileDescriptor >= 0 ) {
+		close( fileDescriptor ); // the mapping stays valid
+	}
+#endif
+	if ( error == 0 && verify == true ) {
+		uint64_t checksum = 0;
+		for ( uint64_t offset = 0; offset < header.payloadSize; offset += header.rowStride ) {
+			checksum = snapshotChecksum( checksum, payload + offset, (size_t) header.rowStride );
+		}
+		error = ( checksum != header.checksum ) ? 5 : 0;
+	}
+	if ( error == 0 ) {
+		Rule rule;
+		char notation[GOL__RULE__NOTATION_SIZE];
+		rule.birth = header.birth;
+		rule.survival = header.survival;
+		formatRule( &rule, notation );
+		newGamePtr = createGameWithStorage( header.gridSizeX, header.gridSizeY, (char) header.outOfBoundsRule, GOL__STORAGE__CONTIGUOUS, (size_t) header.rowStride );
+		if ( newGamePtr == NULL ) {
+			error = 6;
+		} else {
+			setGameRule( newGamePtr, notation );
+			newGamePtr->generation = header.generation;
+		}
+	}
+#ifdef _WINDOWS
+	if ( error == 0 ) {
+		Grid *gridPtr = newGamePtr->currentGridPtr;
+		for ( long long x = 0; x < gridPtr->gridSizeX; ++x ) {
+			memcpy( gridPtr->origin[x], payload + ( x + 1 ) * header.rowStride + GOL__GRID__ROW_OFFSET, gridPtr->arraySizeY * sizeof( uint64_t ) );
+		}
+	}
+	free( payload );
+#else
+	if ( error == 0 ) {
+		/* Swap the freshly allocated rows of the current Grid for the mapped ones. */
+		Grid *gridPtr = newGamePtr->currentGridPtr;
+		uint64_t **rowPointers = (uint64_t **) malloc( ( gridPtr->arraySizeX + 2 ) * sizeof( uint64_t * ) );
+		if ( rowPointers == NULL ) {
+			error = 6;
+			destroyGame( newGamePtr );
+			newGamePtr = NULL;
+		} else {
+			releaseGridStorage( gridPtr );
+			for ( size_t i = 0; i < gridPtr->arraySizeX + 2; ++i ) {
+				rowPointers[i] = (uint64_t *) ( payload + i * header.rowStride + GOL__GRID__ROW_OFFSET );
+			}
+			gridPtr->origin = rowPointers + 1;
+			gridPtr->storage = mapping;
+			gridPtr->storageSize = mappingSize;
+			gridPtr->storageMode = GOL__STORAGE__MAPPED;
+		}
+	}
+	if ( error != 0 && mapping != MAP_FAILED ) {
+		munmap( mapping, mappingSize );
+	}
+#endif
+	if ( error != 0 ) {
+		fprintf( stderr, "ERROR: Could not load the snapshot \"%s\": %s.\n", path, error == 1 ? "unreadable" : error == 2 ? "unsupported version" :
+			error == 3 ? "invalid header" : error == 4 ? "could not map the payload" : error == 5 ? "checksum mismatch" : "out of memory" );
+	}
+	
+	return newGamePtr;
+}
+
+
+/* Out-of-core Grids */
+/* createGameInFile keeps both Grids of a Game in one sparse file, mapped shared: the file can be far larger than memory, since the kernel pages
+ * rows in when they are touched and writes them back when memory runs short. The bitboard engines walk the rows in order and tell the kernel
+ * what comes next and what is done with madvise, so a generation streams through the file once instead of thrashing. Rows that stay empty are
+ * not written, so dead regions remain holes in the file. */
+
+/* Creates a Game whose Grids live in the file at path, which is created or truncated, and left in place by destroyGame. Grid A starts at offset 0,
+ * Grid B at the next page after it; both are laid out as contiguous storage and start out as holes, i.e. all off. The Game steps with
+ * GOL__ENGINE__BITBOARD; the parallel engine and iterateGameN give the same read-ahead hints, the other engines work without them.
+ * Needs mmap; on Windows it fails. Returns a pointer to the Game, if successful. Returns a NULL pointer otherwise. */
+Game *createGameInFile( long long gridSizeX, long long gridSizeY, char outOfBoundsRule, const char *path ) {
+	Game *newGamePtr = NULL;
+	ErrorChar error = 0;
+	
+#ifdef _WINDOWS
+	(void) gridSizeX;
+	(void) gridSizeY;
+	(void) outOfBoundsRule;
+	error = 5;
+#else
+	size_t pageSize = (size_t) sysconf( _SC_PAGESIZE );
+	size_t rowStride = 0;
+	size_t gridBytes = 0;
+	int fileDescriptor = -1;
+	void *mapping = MAP_FAILED;
+	Grid *gridAPtr = NULL;
+	Grid *gridBPtr = NULL;
+	
+	if ( gridSizeX < 0 || gridSizeY < 0 ) {
+		error = 1;
+	} else {
+		rowStride = gridRowStride( (size_t) lldivGreater( gridSizeY + 1, GOL__BITBOARD__CELLS_PER_WORD ).quot, 0 );
+		if ( (size_t) gridSizeX + 2 > ( SIZE_MAX / 2 - pageSize ) / rowStride ) {
+			error = 1;
+		} else {
+			gridBytes = ( ( (size_t) gridSizeX + 2 ) * rowStride + pageSize - 1 ) / pageSize * pageSize;
+		}
+	}
+	if ( error == 0 ) {
+		fileDescriptor = open( path, O_RDWR | O_CREAT | O_TRUNC, 0644 );
+		if ( fileDescriptor < 0 || ftruncate( fileDescriptor, (off_t) ( 2 * gridBytes ) ) != 0 ) {
+			error = 2;
+		}
+	}
+	if ( error == 0 ) {
+		mapping = mmap( NULL, 2 * gridBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0 );
+		if ( mapping == MAP_FAILED ) {
+			error = 3;
+		} else {
+			madvise( mapping, 2 * gridBytes, MADV_SEQUENTIAL );
+		}
+	}
+	if ( fileDescriptor >= 0 ) {
+		close( fileDescriptor ); // the mapping stays valid
+	}
+	if ( error == 0 ) {
+		char *rowsB = (char *) mapping + gridBytes;
+		gridAPtr = createGridOnRows( gridSizeX, gridSizeY, outOfBoundsRule, GOL__STORAGE__FILE, (char *) mapping, rowStride, mapping, gridBytes );
+		gridBPtr = createGridOnRows( gridSizeX, gridSizeY, outOfBoundsRule, GOL__STORAGE__FILE, rowsB, rowStride, rowsB, gridBytes );
+		if ( gridAPtr == NULL || gridBPtr == NULL ) {
+			error = 4;
+			for ( int g = 0; g < 2; ++g ) {
+				Grid *gridPtr = ( g == 0 ) ? gridAPtr : gridBPtr;
+				if ( gridPtr != NULL ) {
+					free( gridPtr->origin - 1 );
+					free( gridPtr );
+				}
+			}
+			munmap( mapping, 2 * gridBytes );
+		} else {
+			newGamePtr = createGameFromGrids( gridAPtr, gridBPtr ); // unmaps each half on failure
+			if ( newGamePtr == NULL ) {
+				error = 4;
+			} else {
+				newGamePtr->engine = GOL__ENGINE__BITBOARD;
+			}
+		}
+	} else if ( mapping != MAP_FAILED ) {
+		munmap( mapping, 2 * gridBytes );
+	}
+#endif
+	if ( error != 0 ) {
+		fprintf( stderr, "ERROR: Could not create a grid with dimensions %lld by %lld in the file \"%s\": %s.\n", gridSizeX, gridSizeY, path,
+			error == 1 ? "invalid size" : error == 2 ? "could not create the file" : error == 3 ? "could not map the file" : error == 4 ? "out of memory" : "not supported" );
+	}
+	
+	return newGamePtr;
+}
+
+/* Returns the number of rows per band in which the bitboard engines read ahead and drop the rows of the Grid: about GOL__FILE__BAND_BYTES,
+ * at least one row. Returns 0, if the Grid is not file-backed, so that the engines give no hints. */
+long long gridAdviceRows( Grid *gridPtr ) {
+	long long adviceRows = 0;
+	
+	if ( gridPtr->storageMode == GOL__STORAGE__FILE ) {
+		adviceRows = (long long) ( GOL__FILE__BAND_BYTES / gridPtr->rowStride );
+		if ( adviceRows < 1 ) {
+			adviceRows = 1;
+		}
+	}
+	
+	return adviceRows;
+}
+
+/* Tells the kernel that rows firstRow .. endRow - 1 of a file-backed Grid are needed soon ( needed == true ), so that they are read ahead,
+ * or not any more, so that their pages leave this process. The rows are clipped to the ghost rows. Dropping only covers pages that lie fully
+ * inside the rows, so the rows of a neighboring band that share a page stay mapped; written cells are kept either way, since the mapping is
+ * shared. Does nothing for other Grids. */
+void adviseGridRows( Grid *gridPtr, long long firstRow, long long endRow, bool needed ) {
+#ifndef _WINDOWS
+	if ( firstRow < -1 ) {
+		firstRow = -1;
+	}
+	if ( endRow > gridPtr->gridSizeX + 1 ) {
+		endRow = gridPtr->gridSizeX + 1;
+	}
+	if ( gridPtr->storageMode == GOL__STORAGE__FILE && firstRow < endRow ) {
+		uintptr_t pageSize = (uintptr_t) sysconf( _SC_PAGESIZE );
+		uintptr_t start = (uintptr_t) ( (char *) gridPtr->origin[firstRow] - GOL__GRID__ROW_OFFSET );
+		uintptr_t end = (uintptr_t) ( (char *) gridPtr->origin[ endRow - 1 ] - GOL__GRID__ROW_OFFSET ) + gridPtr->rowStride;
+		if ( needed == true ) {
+			start = start / pageSize * pageSize;
+			end = ( end + pageSize - 1 ) / pageSize * pageSize;
+		} else {
+			start = ( start + pageSize - 1 ) / pageSize * pageSize;
+			end = end / pageSize * pageSize;
+		}
+		if ( start < end ) {
+			madvise( (void *) start, end - start, needed ? MADV_WILLNEED : MADV_DONTNEED );
+		}
+	}
+#else
+	(void) gridPtr;
+	(void) firstRow;
+	(void) endRow;
+	(void) needed;
+#endif
+}
+
+/* Returns true, if the packed row words has no live cell and row x of the Grid has none either, so that unpacking it can be skipped.
+ * Reading a hole of the file does not allocate disk space, writing zeros into it would. */
+bool skipsEmptyGridRow( Grid *gridPtr, long long x, const uint64_t *words ) {
+	size_t fullWords = (size_t) gridPtr->gridSizeY / GOL__BITBOARD__CELLS_PER_WORD;
+	uint64_t lastMask = ( 1ULL << ( gridPtr->gridSizeY % GOL__BITBOARD__CELLS_PER_WORD ) ) - 1; // bits beyond the row are left over from the kernel
+	const uint64_t *row = gridPtr->origin[x];
+	uint64_t live = ( words[fullWords] | row[fullWords] ) & lastMask;
+	
+	for ( size_t k = 0; live == 0 && k < fullWords; ++k ) {
+		live |= words[k] | row[k];
+	}
+	
+	return live == 0;
+}
+
+
+/* Performance counters */
+#ifdef GOL__PERF_COUNTERS
+/* Every event is opened on its own, counting user space only, so that an unprivileged process may count itself (perf_event_paranoid up to 2),
+ * and with inherit set, so that the worker threads started after it count too; events cannot be read as a group with inherit. Where there are
+ * more events than hardware counters the kernel multiplexes them, and the values are scaled up for the time each event was not counting.
+ * The memory bandwidth is estimated from last-level cache misses, since the uncore counters that measure it need privileges. */
+
+static const uint32_t perfEventTypes[GOL__PERF__EVENTS] = { PERF_TYPE_SOFTWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+	PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_SOFTWARE };
+static const uint64_t perfEventConfigs[GOL__PERF__EVENTS] = { PERF_COUNT_SW_TASK_CLOCK, PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+	PERF_COUNT_HW_CACHE_REFERENCES, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_SW_PAGE_FAULTS };
+static const char *perfEventNames[GOL__PERF__EVENTS] = { "cpu ms", "cycles", "instructions", "LLC references", "LLC misses", "branch misses",
+	"page faults" };
+
+/* Returns the count of the event open on the fd, scaled for multiplexing, or GOL__PERF__UNAVAILABLE. */
+static unsigned long long readPerfCounter( int fd ) {
+	unsigned long long value = GOL__PERF__UNAVAILABLE;
+	uint64_t data[3]; // the count, the time enabled and the time running
+	
+	if ( fd >= 0 && read( fd, data, sizeof( data ) ) == (ssize_t) sizeof( data ) ) {
+		if ( data[2] == 0 ) {
+			value = 0;
+		} else if ( data[2] < data[1] ) {
+			value = (unsigned long long) ( (double) data[0] * (double) data[1] / (double) data[2] );
+		} else {
+			value = data[0];
+		}
+	}
+	
+	return value;
+}
+
+/* Opens the counters for the calling thread and the threads it starts from now on. Passes are logged to the logStream unless it is NULL.
+ * Returns NULL on malloc failure or if no event can be opened. */
+PerfCounters *createPerfCounters( FILE *logStream ) {
+	PerfCounters *newCountersPtr = (PerfCounters *) malloc( sizeof( PerfCounters ) );
+	
+	if ( newCountersPtr == NULL ) {
+		fprintf( stderr, "ERROR: Cannot allocate the performance counters.\n" );
+	} else {
+		int openCount = 0;
+		int lastErrno = 0;
+		for ( int event = 0; event < GOL__PERF__EVENTS; ++event ) {
+			struct perf_event_attr attributes;
+			memset( &attributes, 0, sizeof( attributes ) );
+			attributes.type = perfEventTypes[event];
+			attributes.size = sizeof( attributes );
+			attributes.config = perfEventConfigs[event];
+			attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+			attributes.inherit = 1;
+			attributes.exclude_kernel = 1;
+			attributes.exclude_hv = 1;
+			newCountersPtr->fds[event] = (int) syscall( __NR_perf_event_open, &attributes, 0, -1, -1, PERF_FLAG_FD_CLOEXEC );
+			if ( newCountersPtr->fds[event] >= 0 ) {
+				++openCount;
+			} else {
+				lastErrno = errno;
+			}
+		}
+		if ( openCount == 0 ) {
+			fprintf( stderr, "ERROR: perf_event_open failed: %s. See /proc/sys/kernel/perf_event_paranoid.\n", strerror( lastErrno ) );
+			free( newCountersPtr );
+			newCountersPtr = NULL;
+		} else {
+			newCountersPtr->logStream = logStream;
+			resetPerfCounters( newCountersPtr );
+		}
+	}
+	
+	return newCountersPtr;
+}
+
+/* Closes the counters pointed at by the oldCountersPtr. Frees the memory. */
+void destroyPerfCounters( PerfCounters *oldCountersPtr ) {
+	for ( int event = 0; event < GOL__PERF__EVENTS; ++event ) {
+		if ( oldCountersPtr->fds[event] >= 0 ) {
+			close( oldCountersPtr->fds[event] );
+		}
+	}
+	free( oldCountersPtr );
+}
+
+/* Zeroes the last and the total sample. */
+void resetPerfCounters( PerfCounters *countersPtr ) {
+	countersPtr->total.generations = 0;
+	countersPtr->total.seconds = 0.0;
+	for ( int event = 0; event < GOL__PERF__EVENTS; ++event ) {
+		countersPtr->total.values[event] = ( countersPtr->fds[event] >= 0 ) ? 0 : GOL__PERF__UNAVAILABLE;
+		countersPtr->startValues[event] = GOL__PERF__UNAVAILABLE;
+	}
+	countersPtr->last = countersPtr->total;
+	countersPtr->startSeconds = monotonicSeconds();
+}
+
+/* Starts a sample: reads every counter and the clock. */
+void beginPerfSample( PerfCounters *countersPtr ) {
+	for ( int event = 0; event < GOL__PERF__EVENTS; ++event ) {
+		countersPtr->startValues[event] = readPerfCounter( countersPtr->fds[event] );
+	}
+	countersPtr->startSeconds = monotonicSeconds();
+}
+
+/* Ends the sample started by beginPerfSample, which covered generations generations up to lastGeneration: stores it as the last sample,
+ * adds it to the total and logs it. */
+void endPerfSample( PerfCounters *countersPtr, unsigned long long generations, unsigned long long lastGeneration ) {
+	PerfSample *lastPtr = &(countersPtr->last);
+	PerfSample *totalPtr = &(countersPtr->total);
+	
+	lastPtr->seconds = monotonicSeconds() - countersPtr->startSeconds;
+	lastPtr->generations = generations;
+	for ( int event = 0; event < GOL__PERF__EVENTS; ++event ) {
+		unsigned long long start = countersPtr->startValues[event];
+		unsigned long long end = readPerfCounter( countersPtr->fds[event] );
+		if ( start == GOL__PERF__UNAVAILABLE || end == GOL__PERF__UNAVAILABLE ) {
+			lastPtr->values[event] = GOL__PERF__UNAVAILABLE;
+		} else {
+			lastPtr->values[event] = ( end > start ) ? end - start : 0; // scaling can make a multiplexed count step back
+			if ( totalPtr->values[event] != GOL__PERF__UNAVAILABLE ) {
+				totalPtr->values[event] += lastPtr->values[event];
+			}
+		}
+	}
+	totalPtr->seconds += lastPtr->seconds;
+	totalPtr->generations += generations;
+	if ( countersPtr->logStream != NULL ) {
+		char label[64];
+		if ( generations > 1 ) {
+			snprintf( label, sizeof( label ), "generations %llu-%llu", lastGeneration - generations + 1, lastGeneration );
+		} else {
+			snprintf( label, sizeof( label ), "generation %llu", lastGeneration );
+		}
+		printPerfSample( countersPtr->logStream, label, lastPtr, 1 );
+	}
+}
+
+/* Prints a line with the sample: the counts divided by the divisor (e.g. the generations, for averages; 0 counts as 1), then the
+ * instructions per cycle, the share of last-level cache references that miss and the memory bandwidth those misses imply. */
+void printPerfSample( FILE *stream, const char *label, const PerfSample *samplePtr, unsigned long long divisor ) {
+	const unsigned long long *values = samplePtr->values;
+	double scale = ( divisor > 1 ) ? 1.0 / (double) divisor : 1.0;
+	
+	fprintf( stream, "%s: %llu generations in %.3f ms", label, samplePtr->generations, samplePtr->seconds * 1e3 );
+	for ( int event = 0; event < GOL__PERF__EVENTS; ++event ) {
+		if ( values[event] != GOL__PERF__UNAVAILABLE ) {
+			if ( event == GOL__PERF__TASK_CLOCK ) {
+				fprintf( stream, ", %s %.3f", perfEventNames[event], (double) values[event] * scale * 1e-6 );
+			} else {
+				fprintf( stream, ", %s %.0f", perfEventNames[event], (double) values[event] * scale );
+			}
+		}
+	}
+	if ( values[GOL__PERF__CYCLES] != GOL__PERF__UNAVAILABLE && values[GOL__PERF__INSTRUCTIONS] != GOL__PERF__UNAVAILABLE && values[GOL__PERF__CYCLES] > 0 ) {
+		fprintf( stream, ", IPC %.2f", (double) values[GOL__PERF__INSTRUCTIONS] / (double) values[GOL__PERF__CYCLES] );
+	}
+	if ( values[GOL__PERF__CACHE_REFERENCES] != GOL__PERF__UNAVAILABLE && values[GOL__PERF__CACHE_MISSES] != GOL__PERF__UNAVAILABLE
+			&& values[GOL__PERF__CACHE_REFERENCES] > 0 ) {
+		fprintf( stream, ", LLC miss rate %.1f%%", 100.0 * (double) values[GOL__PERF__CACHE_MISSES] / (double) values[GOL__PERF__CACHE_REFERENCES] );
+	}
+	if ( values[GOL__PERF__CACHE_MISSES] != GOL__PERF__UNAVAILABLE && samplePtr->seconds > 0.0 ) {
+		fprintf( stream, ", ~%.2f GB/s from memory", (double) values[GOL__PERF__CACHE_MISSES] * GOL__PERF__LINE_BYTES / samplePtr->seconds * 1e-9 );
+	}
+	fputc( '\n', stream );
+}
+
+/* Counts the engine passes of the Game from now on, logging each to the logStream unless it is NULL. The thread pool of the Game is
+ * shut down, so that its workers start again under the counters. Returns 0 on success; > 0 if the counters cannot be opened. */
+ErrorChar enableGamePerfCounters( Game *gamePtr, FILE *logStream ) {
+	ErrorChar error = 0;
+	
+	if ( gamePtr->perfCountersPtr != NULL ) {
+		gamePtr->perfCountersPtr->logStream = logStream;
+	} else {
+		gamePtr->perfCountersPtr = createPerfCounters( logStream );
+		if ( gamePtr->perfCountersPtr == NULL ) {
+			error = 1;
+		} else if ( gamePtr->threadPoolPtr != NULL ) {
+			destroyThreadPool( gamePtr->threadPoolPtr );
+			gamePtr->threadPoolPtr = NULL;
+		}
+	}
+	
+	return error;
+}
+
+/* Stops counting the engine passes of the Game and closes its counters. */
+void disableGamePerfCounters( Game *gamePtr ) {
+	if ( gamePtr->perfCountersPtr != NULL ) {
+		destroyPerfCounters( gamePtr->perfCountersPtr );
+		gamePtr->perfCountersPtr = NULL;
+	}
+}
+
+/* Prints the counts of the Game since its counters were enabled or reset, in total and per generation. */
+void printGamePerfCounters( Game *gamePtr, FILE *stream ) {
+	if ( gamePtr->perfCountersPtr != NULL ) {
+		const PerfSample *totalPtr = &(gamePtr->perfCountersPtr->total);
+		printPerfSample( stream, "run", totalPtr, 1 );
+		printPerfSample( stream, "per generation", totalPtr, totalPtr->generations );
+	}
+}
+#endif
+
+
+/* Benchmark */
+/* Every workload is seeded identically for every engine, so the population column doubles as a cross-check between them
+ * (HashLife and the Plane let the pattern leave the Grid, so they only agree with each other).
+ * Cell updates are counted as gridSizeX * gridSizeY per generation for all engines, the unbounded ones included. */
+
+static const BenchmarkWorkload benchmarkWorkloads[] = {
+	{ "soup-15", 1024, 1024, GOL__OOBR__ALL_OFF, GOL__PATTERN__SOUP, 0.15, "B3/S23" },
+	{ "soup-35", 1024, 1024, GOL__OOBR__ALL_OFF, GOL__PATTERN__SOUP, 0.35, "B3/S23" },
+	{ "soup-50", 1024, 1024, GOL__OOBR__ALL_OFF, GOL__PATTERN__SOUP, 0.50, "B3/S23" },
+	{ "glider-gun", 512, 512, GOL__OOBR__ALL_OFF, GOL__PATTERN__GLIDER_GUN, 0.0, "B3/S23" },
+	{ "r-pentomino", 1024, 1024, GOL__OOBR__ALL_OFF, GOL__PATTERN__R_PENTOMINO, 0.0, "B3/S23" },
+	{ "torus-35", 2048, 2048, GOL__OOBR__TORUS, GOL__PATTERN__SOUP, 0.35, "B3/S23" },
+	{ "highlife-35", 1024, 1024, GOL__OOBR__TORUS, GOL__PATTERN__SOUP, 0.35, "B36/S23" },
+	{ "daynight-50", 1024, 1024, GOL__OOBR__TORUS, GOL__PATTERN__SOUP, 0.50, "B3678/S34678" }
+};
+
+/* Returns the number of live cells in the current Grid of the Game. */
+static unsigned long long benchmarkGamePopulation( Game *gamePtr ) {
+	Grid *gridPtr = gamePtr->currentGridPtr;
+	unsigned long long population = 0;
+	
+	for ( long long x = 0; x < gridPtr->gridSizeX; ++x ) {
+		for ( long long y = 0; y < gridPtr->gridSizeY; ++y ) {
+			population += ( getCell( gridPtr, x, y ) == GOL__CELL_STATE__ON );
+		}
+	}
+	
+	return population;
+}
+
+/* Times generations generations of the workload with one engine of a Game, through iterateGameN ( blocked == true ) or iterateGame.
+ * Returns 0 on success; > 0 on malloc failure. */
+static ErrorChar benchmarkGameEngine( const BenchmarkWorkload *workloadPtr, uint64_t seed, char engine, bool blocked, unsigned long long generations, BenchmarkResult *resultPtr ) {
+	ErrorChar error = 0;
+	
+	Game *gamePtr = createGame( workloadPtr->gridSizeX, workloadPtr->gridSizeY, workloadPtr->outOfBoundsRule );
+	
+	if ( gamePtr == NULL ) {
+		error = 1;
+	} else {
+		setGameEngine( gamePtr, engine );
+		setGameRule( gamePtr, workloadPtr->rule );
+#ifdef GOL__PERF_COUNTERS
+		enableGamePerfCounters( gamePtr, NULL ); // before the warm-up, so that the thread pool starts under the counters
+#endif
+		iterateGame( gamePtr ); // warm up: thread pool, tile activity, first touch of both Grids
+		seedBenchmarkWorkload( gamePtr->currentGridPtr, workloadPtr, seed );
+		invalidateGameActivity( gamePtr );
+#ifdef GOL__PERF_COUNTERS
+		if ( gamePtr->perfCountersPtr != NULL ) {
+			resetPerfCounters( gamePtr->perfCountersPtr );
+		}
+#endif
+		
+		double start = monotonicSeconds();
+		if ( blocked == true ) {
+			iterateGameN( gamePtr, generations );
+		} else {
+			for ( unsigned long long i = 0; i < generations; ++i ) {
+				iterateGame( gamePtr );
+			}
+		}
+		resultPtr->seconds = monotonicSeconds() - start;
+		resultPtr->generations = generations;
+		resultPtr->population = benchmarkGamePopulation( gamePtr );
+#ifdef GOL__PERF_COUNTERS
+		if ( gamePtr->perfCountersPtr != NULL ) {
+			char label[128];
+			snprintf( label, sizeof( label ), "%s / %s / %s", resultPtr->workload, resultPtr->engine, resultPtr->kernel );
+			printPerfSample( stderr, label, &(gamePtr->perfCountersPtr->total), gamePtr->perfCountersPtr->total.generations );
+		}
+#endif
+		destroyGame( gamePtr );
+	}
+	
+	return error;
+}
+
+/* Times the workload on a HashLife universe ( unbounded == false ) or a Plane ( unbounded == true ). Returns 0 on success; > 0 on error. */
+static ErrorChar benchmarkUnbounded( const BenchmarkWorkload *workloadPtr, uint64_t seed, bool unbounded, unsigned long long generations, BenchmarkResult *resultPtr ) {
+	ErrorChar error = 0;
+	
+	Game *gamePtr = createGame( workloadPtr->gridSizeX, workloadPtr->gridSizeY, workloadPtr->outOfBoundsRule );
+	
+	if ( gamePtr == NULL ) {
+		error = 1;
+	} else {
+		seedBenchmarkWorkload( gamePtr->currentGridPtr, workloadPtr, seed );
+		setGameRule( gamePtr, workloadPtr->rule ); // so that the import refuses a rule other than Conway's
+		if ( unbounded == false ) {
+			HashLife *universePtr = createHashLife();
+			if ( universePtr == NULL || importGameIntoHashLife( universePtr, gamePtr ) != 0 ) {
+				error = 1;
+			} else {
+				double start = monotonicSeconds();
+				error = stepHashLife( universePtr, generations );
+				resultPtr->seconds = monotonicSeconds() - start;
+				resultPtr->population = hashLifePopulation( universePtr );
+			}
+			if ( universePtr != NULL ) {
+				destroyHashLife( universePtr );
+			}
+		} else {
+			Plane *planePtr = createPlane();
+			if ( planePtr == NULL || importGameIntoPlane( planePtr, gamePtr ) != 0 ) {
+				error = 1;
+			} else {
+				double start = monotonicSeconds();
+				for ( unsigned long long i = 0; error == 0 && i < generations; ++i ) {
+					error = iteratePlane( planePtr );
+				}
+				resultPtr->seconds = monotonicSeconds() - start;
+				resultPtr->population = planePopulation( planePtr );
+			}
+			if ( planePtr != NULL ) {
+				destroyPlane( planePtr );
+			}
+		}
+		resultPtr->generations = generations;
+		destroyGame( gamePtr );
+	}
+	
+	return error;
+}
+
+/* Times 64 soups of GOL__BENCHMARK__SOUP_SIZE squared cells at density 0.375 under Conway's rule, either as one GameBatch or as 64 bitboard Games
+ * stepped one after another. The result counts the soups as a single grid of GOL__BENCHMARK__SOUP_SIZE by 64 * GOL__BENCHMARK__SOUP_SIZE cells. */
+static ErrorChar benchmarkSoupBatch( bool batched, unsigned long long generations, BenchmarkResult *resultPtr ) {
+	ErrorChar error = 0;
+	
+	GameBatch *batchPtr = createGameBatch( GOL__BENCHMARK__SOUP_SIZE, GOL__BENCHMARK__SOUP_SIZE, GOL__OOBR__ALL_OFF );
+	Game *gamePtrs[64] = { NULL };
+	
+	if ( batchPtr == NULL ) {
+		error = 1;
+	} else {
+		randomizeGameBatch( batchPtr, 1, 0.375 );
+		resultPtr->population = 0;
+		if ( batched == true ) {
+			double start = monotonicSeconds();
+			for ( unsigned long long i = 0; i < generations; ++i ) {
+				iterateGameBatch( batchPtr );
+			}
+			resultPtr->seconds = monotonicSeconds() - start;
+			for ( int lane = 0; lane < 64; ++lane ) {
+				resultPtr->population += gameBatchLanePopulation( batchPtr, lane );
+			}
+		} else {
+			for ( int lane = 0; error == 0 && lane < 64; ++lane ) {
+				gamePtrs[lane] = createGame( GOL__BENCHMARK__SOUP_SIZE, GOL__BENCHMARK__SOUP_SIZE, GOL__OOBR__ALL_OFF );
+				if ( gamePtrs[lane] == NULL ) {
+					error = 1;
+				} else {
+					setGameEngine( gamePtrs[lane], GOL__ENGINE__BITBOARD );
+					error = exportGameBatchLane( batchPtr, lane, gamePtrs[lane] );
+				}
+			}
+			if ( error == 0 ) {
+				double start = monotonicSeconds();
+				for ( int lane = 0; lane < 64; ++lane ) {
+					for ( unsigned long long i = 0; i < generations; ++i ) {
+						iterateGame( gamePtrs[lane] );
+					}
+				}
+				resultPtr->seconds = monotonicSeconds() - start;
+				for ( int lane = 0; lane < 64; ++lane ) {
+					resultPtr->population += benchmarkGamePopulation( gamePtrs[lane] );
+				}
+			}
+			for ( int lane = 0; lane < 64; ++lane ) {
+				if ( gamePtrs[lane] != NULL ) {
+					destroyGame( gamePtrs[lane] );
+				}
+			}
+		}
+		resultPtr->generations = generations;
+		destroyGameBatch( batchPtr );
+	}
+	
+	return error;
+}
+
+/* Runs every workload on every engine, and the bitboard engine with every row kernel the CPU supports, for the given number of
+ * generations (the reference engine for a fraction of them), and prints one result per run to stdout as it completes.
+ * HashLife and the Plane model an infinite dead plane under Conway's rule, so they skip the torus workloads. Last come 64 small soups as Games and as a GameBatch. Returns 0 on success; > 0 on error. */
+ErrorChar runBenchmarks( unsigned long long generations, char format ) {
+	ErrorChar error = 0;
+	
+	char originalKernel = activeRowKernel();
+	bool first = true;
+	
+	if ( format == GOL__BENCHMARK__TEXT ) {
+		printf( "%-12s %-10s %-9s %11s %11s %10s %12s %14s %9s %12s %12s\n",
+			"workload", "engine", "kernel", "size", "generations", "seconds", "gens/s", "cells/s", "ns/cell", "population", "peak RSS KiB" );
+	} else if ( format == GOL__BENCHMARK__CSV ) {
+		printf( "workload,engine,kernel,size_x,size_y,generations,seconds,generations_per_second,cells_per_second,ns_per_cell,population,peak_rss_kib\n" );
+	} else {
+		printf( "[\n" );
+	}
+	for ( size_t w = 0; w < sizeof( benchmarkWorkloads ) / sizeof( benchmarkWorkloads[0] ); ++w ) {
+		const BenchmarkWorkload *workloadPtr = &benchmarkWorkloads[w];
+		uint64_t seed = w + 1;
+		/* Runs: reference, scalar, bitboard per kernel, parallel, tiled, lookup, bitboard and parallel through iterateGameN, HashLife, Plane. */
+		char engines[] = { GOL__ENGINE__REFERENCE, GOL__ENGINE__SCALAR, GOL__ENGINE__BITBOARD, GOL__ENGINE__BITBOARD, GOL__ENGINE__BITBOARD,
+			GOL__ENGINE__PARALLEL, GOL__ENGINE__TILED, GOL__ENGINE__LOOKUP, GOL__ENGINE__BITBOARD, GOL__ENGINE__PARALLEL };
+		char kernels[] = { GOL__KERNEL__AUTO, GOL__KERNEL__AUTO, GOL__KERNEL__PORTABLE, GOL__KERNEL__AVX2, GOL__KERNEL__AVX512,
+			GOL__KERNEL__AUTO, GOL__KERNEL__AUTO, GOL__KERNEL__AUTO, GOL__KERNEL__AUTO, GOL__KERNEL__AUTO };
+		const char *engineNames[] = { "reference", "scalar", "bitboard", "bitboard", "bitboard", "parallel", "tiled", "lookup", "bitboard-n",
+			"parallel-n", "hashlife", "plane" };
+		size_t runCount = sizeof( engineNames ) / sizeof( engineNames[0] );
+		
+		for ( size_t run = 0; run < runCount; ++run ) {
+			BenchmarkResult result = { workloadPtr->name, engineNames[run], "-", workloadPtr->gridSizeX, workloadPtr->gridSizeY, 0, 0.0, 0, 0 };
+			ErrorChar runError = 0;
+			if ( run < sizeof( engines ) ) {
+				bool usesKernel = engines[run] != GOL__ENGINE__REFERENCE && engines[run] != GOL__ENGINE__SCALAR && engines[run] != GOL__ENGINE__LOOKUP;
+				if ( rowKernelSupported( kernels[run] ) == false ) {
+					continue;
+				}
+				selectRowKernel( kernels[run] == GOL__KERNEL__AUTO ? originalKernel : kernels[run] );
+				if ( usesKernel == true ) {
+					result.kernel = rowKernelName( activeRowKernel() );
+				}
+				unsigned long long runGenerations = generations;
+				if ( engines[run] == GOL__ENGINE__REFERENCE ) {
+					runGenerations = ( generations + GOL__BENCHMARK__REFERENCE_SHARE - 1 ) / GOL__BENCHMARK__REFERENCE_SHARE;
+				}
+				runError = benchmarkGameEngine( workloadPtr, seed, engines[run], run >= sizeof( engines ) - 2, runGenerations, &result );
+			} else if ( workloadPtr->outOfBoundsRule == GOL__OOBR__TORUS ) {
+				continue;
+			} else {
+				runError = benchmarkUnbounded( workloadPtr, seed, run == runCount - 1, generations, &result );
+			}
+			if ( runError != 0 ) {
+				fprintf( stderr, "ERROR: Benchmark run %s / %s failed.\n", workloadPtr->name, engineNames[run] );
+				error = 1;
+			} else {
+				result.peakResidentKilobytes = peakResidentKilobytes();
+				printBenchmarkResult( &result, format, first );
+				first = false;
+			}
+			fflush( stdout );
+		}
+	}
+	for ( int batched = 0; batched < 2; ++batched ) {
+		BenchmarkResult result = { "soups-32", batched ? "batch" : "games", "-", GOL__BENCHMARK__SOUP_SIZE, 64 * GOL__BENCHMARK__SOUP_SIZE, 0, 0.0, 0, 0 };
+		if ( benchmarkSoupBatch( batched, generations, &result ) != 0 ) {
+			fprintf( stderr, "ERROR: Benchmark run %s / %s failed.\n", result.workload, result.engine );
+			error = 1;
+		} else {
+			result.peakResidentKilobytes = peakResidentKilobytes();
+			printBenchmarkResult( &result, format, first );
+			first = false;
+		}
+		fflush( stdout );
+	}
+	if ( format == GOL__BENCHMARK__JSON ) {
+		printf( "\n]\n" );
 	}
+	selectRowKernel( originalKernel );
+	
+	return error;
 }
 
-/* Prints the current state of a Game into stdout. */
-void printGame( Game * gamePtr, PrintOptions *optionsPtr ) {
-	printGrid( gamePtr->currentGridPtr, optionsPtr );
+/* Seeds the Grid, which must be empty, with the pattern of the workload. Soups come from a xorshift generator, so a seed gives the same soup on every platform. */
+void seedBenchmarkWorkload( Grid *gridPtr, const BenchmarkWorkload *workloadPtr, uint64_t seed ) {
+	if ( workloadPtr->pattern == GOL__PATTERN__SOUP ) {
+		uint64_t state = seed * 0x9E3779B97F4A7C15ULL + 1;
+		uint64_t threshold = (uint64_t) ( workloadPtr->density * 9007199254740992.0 ); // density * 2^53
+		for ( long long x = 0; x < gridPtr->gridSizeX; ++x ) {
+			for ( long long y = 0; y < gridPtr->gridSizeY; ++y ) {
+				state ^= state << 13;
+				state ^= state >> 7;
+				state ^= state << 17;
+				if ( ( state >> 11 ) < threshold ) {
+					setCell( gridPtr, x, y, GOL__CELL_STATE__ON );
+				}
+			}
+		}
+	} else if ( workloadPtr->pattern == GOL__PATTERN__GLIDER_GUN ) {
+		placeGliderGun( gridPtr );
+	} else if ( workloadPtr->pattern >= GOL__PATTERN__FULL ) {
+		const long long glider[5][2] = { { 0, 1 }, { 1, 2 }, { 2, 0 }, { 2, 1 }, { 2, 2 } }; // heads towards growing x and y
+		long long sizeX = gridPtr->gridSizeX;
+		long long sizeY = gridPtr->gridSizeY;
+		for ( long long x = 0; x < sizeX; ++x ) {
+			for ( long long y = 0; y < sizeY; ++y ) {
+				bool on = workloadPtr->pattern == GOL__PATTERN__FULL
+					|| ( workloadPtr->pattern == GOL__PATTERN__BORDER && ( x == 0 || y == 0 || x == sizeX - 1 || y == sizeY - 1 ) )
+					|| ( workloadPtr->pattern == GOL__PATTERN__CHECKERBOARD && ( x + y ) % 2 == 0 );
+				if ( on == true ) {
+					setCell( gridPtr, x, y, GOL__CELL_STATE__ON );
+				}
+			}
+		}
+		for ( int corner = 0; workloadPtr->pattern == GOL__PATTERN__CORNER_GLIDERS && corner < 4; ++corner ) {
+			for ( int cell = 0; cell < 5; ++cell ) {
+				long long x = ( corner & 1 ) ? sizeX - 3 + glider[cell][0] : 2 - glider[cell][0]; // mirrored, so that every glider leaves
+				long long y = ( corner & 2 ) ? sizeY - 3 + glider[cell][1] : 2 - glider[cell][1];
+				if ( x >= 0 && x < sizeX && y >= 0 && y < sizeY ) {
+					setCell( gridPtr, x, y, GOL__CELL_STATE__ON );
+				}
+			}
+		}
+	} else {
+		const long long rPentomino[5][2] = { { -1, 0 }, { -1, 1 }, { 0, -1 }, { 0, 0 }, { 1, 0 } };
+		for ( int cell = 0; cell < 5; ++cell ) {
+			long long x = gridPtr->gridSizeX / 2 + rPentomino[cell][0];
+			long long y = gridPtr->gridSizeY / 2 + rPentomino[cell][1];
+			if ( x >= 0 && x < gridPtr->gridSizeX && y >= 0 && y < gridPtr->gridSizeY ) { // clipped on tiny Grids
+				setCell( gridPtr, x, y, GOL__CELL_STATE__ON );
+			}
+		}
+	}
 }
 
-/* Randomizes all cells in a Game. */
-void randomizeGame( Game * gamePtr ){
-	randomizeGrid( gamePtr->currentGridPtr );
+/* Prints one benchmark result to stdout as a text table row, a CSV line or a JSON object. first is true for the first result of a JSON array. */
+void printBenchmarkResult( const BenchmarkResult *resultPtr, char format, bool first ) {
+	double cells = (double) resultPtr->gridSizeX * (double) resultPtr->gridSizeY * (double) resultPtr->generations;
+	double seconds = ( resultPtr->seconds > 0.0 ) ? resultPtr->seconds : 1e-9;
+	double generationsPerSecond = (double) resultPtr->generations / seconds;
+	double cellsPerSecond = cells / seconds;
+	double nanosecondsPerCell = ( cells > 0.0 ) ? seconds * 1e9 / cells : 0.0;
+	
+	if ( format == GOL__BENCHMARK__TEXT ) {
+		char size[32];
+		snprintf( size, sizeof( size ), "%lldx%lld", resultPtr->gridSizeX, resultPtr->gridSizeY );
+		printf( "%-12s %-10s %-9s %11s %11llu %10.4f %12.1f %14.4g %9.4f %12llu %12ld\n", resultPtr->workload, resultPtr->engine, resultPtr->kernel,
+			size, resultPtr->generations, resultPtr->seconds, generationsPerSecond, cellsPerSecond, nanosecondsPerCell, resultPtr->population,
+			resultPtr->peakResidentKilobytes );
+	} else if ( format == GOL__BENCHMARK__CSV ) {
+		printf( "%s,%s,%s,%lld,%lld,%llu,%.6f,%.3f,%.6g,%.6f,%llu,%ld\n", resultPtr->workload, resultPtr->engine, resultPtr->kernel,
+			resultPtr->gridSizeX, resultPtr->gridSizeY, resultPtr->generations, resultPtr->seconds, generationsPerSecond, cellsPerSecond,
+			nanosecondsPerCell, resultPtr->population, resultPtr->peakResidentKilobytes );
+	} else {
+		printf( "%s  {\"workload\": \"%s\", \"engine\": \"%s\", \"kernel\": \"%s\", \"size_x\": %lld, \"size_y\": %lld, \"generations\": %llu, "
+			"\"seconds\": %.6f, \"generations_per_second\": %.3f, \"cells_per_second\": %.6g, \"ns_per_cell\": %.6f, \"population\": %llu, "
+			"\"peak_rss_kib\": %ld}", first ? "" : ",\n", resultPtr->workload, resultPtr->engine, resultPtr->kernel, resultPtr->gridSizeX,
+			resultPtr->gridSizeY, resultPtr->generations, resultPtr->seconds, generationsPerSecond, cellsPerSecond, nanosecondsPerCell,
+			resultPtr->population, resultPtr->peakResidentKilobytes );
+	}
 }
 
-/* An endless loop to showcase the evolution of a Game of Life Game. Prints to stdout. */
-void printAndIterateGameLoop( Game * gamePtr, PrintOptions *optionsPtr, unsigned int sleepInMilliseconds ) {
-	bool running = true;
+
+/* Verification */
+/* Every faster engine must produce exactly the Grids of the reference engine, which applies the rule one cell at a time through getCell.
+ * verifyEngines steps one pattern with every variant below and with a GameBatch next to a reference Game, in rounds of 1 to
+ * GOL__TEMPORAL__GENERATIONS + 3 generations so that the passes of iterateGameN are cut at every length, and compares every cell after
+ * every round. The GenerationStats that the bitboard engines gather in passing must match those measured on the reference Grids.
+ * With GOL__OOBR__ALL_OFF and Conway's rule, a HashLife universe and a Plane run the pattern as well: as long as no cell on the edge of the
+ * Grid is alive, nothing can be born beyond it, so the unbounded plane must agree with the Grid. Each is exported into a Game of its own that
+ * has just stepped an empty Grid on the tiled engine, so that every tile counts as stable; it then steps once from the export and is compared
+ * again after the next generation, so an export that leaves the tile activity or the stats of the Game stale shows up as well. */
+
+static const VerifyVariant verifyVariants[] = {
+	{ "scalar", GOL__ENGINE__SCALAR, GOL__KERNEL__AUTO, false, GOL__STORAGE__CONTIGUOUS },
+	{ "bitboard/portable", GOL__ENGINE__BITBOARD, GOL__KERNEL__PORTABLE, false, GOL__STORAGE__CONTIGUOUS },
+	{ "bitboard/avx2", GOL__ENGINE__BITBOARD, GOL__KERNEL__AVX2, false, GOL__STORAGE__CONTIGUOUS },
+	{ "bitboard/avx512", GOL__ENGINE__BITBOARD, GOL__KERNEL__AVX512, false, GOL__STORAGE__CONTIGUOUS },
+	{ "bitboard/rows", GOL__ENGINE__BITBOARD, GOL__KERNEL__AUTO, false, GOL__STORAGE__ROWS },
+	{ "parallel", GOL__ENGINE__PARALLEL, GOL__KERNEL__AUTO, false, GOL__STORAGE__CONTIGUOUS },
+	{ "tiled", GOL__ENGINE__TILED, GOL__KERNEL__AUTO, false, GOL__STORAGE__CONTIGUOUS },
+	{ "lookup", GOL__ENGINE__LOOKUP, GOL__KERNEL__AUTO, false, GOL__STORAGE__ROWS },
+	{ "bitboard-n/portable", GOL__ENGINE__BITBOARD, GOL__KERNEL__PORTABLE, true, GOL__STORAGE__CONTIGUOUS },
+	{ "bitboard-n/rows", GOL__ENGINE__BITBOARD, GOL__KERNEL__AUTO, true, GOL__STORAGE__ROWS },
+	{ "parallel-n", GOL__ENGINE__PARALLEL, GOL__KERNEL__AUTO, true, GOL__STORAGE__CONTIGUOUS },
+	{ "bitboard/file", GOL__ENGINE__BITBOARD, GOL__KERNEL__AUTO, false, GOL__STORAGE__FILE },
+	{ "parallel-n/mapped", GOL__ENGINE__PARALLEL, GOL__KERNEL__AUTO, true, GOL__STORAGE__MAPPED }
+};
+
+static const char *verifyBoundaryNames[] = { "all-off", "all-on", "torus" }; // by GOL__OOBR__*
+static const char *verifyExportNames[] = { "hashlife", "plane", "tiled after a hashlife export", "tiled after a plane export" };
+static const char *verifyPatternNames[] = { "soup", "glider-gun", "r-pentomino", "full", "border", "checkerboard", "corner-gliders" }; // by GOL__PATTERN__*
+
+/* Writes the first cell in which the Grids, which have the same size, differ to xPtr and yPtr. Returns true, if there is one. */
+static bool findDifferentCell( Grid *gridPtr, Grid *otherGridPtr, long long *xPtr, long long *yPtr ) {
+	bool found = false;
 	
-	fflush( stdout );
-	clearCmd();
+	for ( long long x = 0; found == false && x < gridPtr->gridSizeX; ++x ) {
+		for ( long long y = 0; found == false && y < gridPtr->gridSizeY; ++y ) {
+			if ( getCell( gridPtr, x, y ) != getCell( otherGridPtr, x, y ) ) {
+				*xPtr = x;
+				*yPtr = y;
+				found = true;
+			}
+		}
+	}
 	
-	printf( "GAME OF LIFE\n" );
-	putc( '\n', stdout );
+	return found;
+}
+
+/* Compares a Game that HashLife or the Plane was exported into with the reference: every cell, and the population by getGameStats, which is
+ * stale if the export did not invalidate the Game. Reports a difference on stderr. Returns 0 if they agree; 1 if they do not; 2 on malloc failure. */
+static ErrorChar compareExportedGame( Game *exportPtr, Game *referencePtr, const char *name, unsigned long long generation, const char *description ) {
+	ErrorChar error = 0;
 	
-	while ( running == true ) {
-		printGame( gamePtr, optionsPtr );		
-		iterateGame( gamePtr );
-		
-		fflush( stdout );
-		Sleep( sleepInMilliseconds );
-		clearCmd();
+	const GenerationStats *statsPtr = getGameStats( exportPtr );
+	const GenerationStats *referenceStatsPtr = getGameStats( referencePtr );
+	long long x;
+	long long y;
+	
+	if ( statsPtr == NULL || referenceStatsPtr == NULL ) {
+		error = 2;
+	} else if ( findDifferentCell( referencePtr->currentGridPtr, exportPtr->currentGridPtr, &x, &y ) == true ) {
+		fprintf( stderr, "ERROR: %s differs from the reference in cell ( %lld, %lld ) after generation %llu of %s.\n", name, x, y, generation, description );
+		error = 1;
+	} else if ( statsPtr->population != referenceStatsPtr->population ) {
+		fprintf( stderr, "ERROR: The statistics of %s count %llu live cells, the reference %llu, after generation %llu of %s.\n", name,
+			(unsigned long long) statsPtr->population, (unsigned long long) referenceStatsPtr->population, generation, description );
+		error = 1;
 	}
+	
+	return error;
 }
 
+/* Returns true, if no cell on the edge of the Grid is alive. */
+static bool gridEdgeIsEmpty( Grid *gridPtr ) {
+	bool empty = true;
+	
+	for ( long long x = 0; empty == true && x < gridPtr->gridSizeX; ++x ) {
+		empty = getCell( gridPtr, x, 0 ) == GOL__CELL_STATE__OFF && getCell( gridPtr, x, gridPtr->gridSizeY - 1 ) == GOL__CELL_STATE__OFF;
+	}
+	for ( long long y = 0; empty == true && y < gridPtr->gridSizeY; ++y ) {
+		empty = getCell( gridPtr, 0, y ) == GOL__CELL_STATE__OFF && getCell( gridPtr, gridPtr->gridSizeX - 1, y ) == GOL__CELL_STATE__OFF;
+	}
+	
+	return empty;
+}
 
-/* Moludo functions */
+/* Writes the path of a scratch file of the verification, unique to the process, to path. */
+static void verifyScratchPath( char *path, size_t size, const char *extension ) {
+#ifdef _WINDOWS
+	const char *directory = getenv( "TEMP" );
+	const char *defaultDirectory = ".";
+	unsigned long process = (unsigned long) GetCurrentProcessId();
+#else
+	const char *directory = getenv( "TMPDIR" );
+	const char *defaultDirectory = "/tmp";
+	unsigned long process = (unsigned long) getpid();
+#endif
+	snprintf( path, size, "%s/gameOfLife-verify-%lu.%s", ( directory != NULL ) ? directory : defaultDirectory, process, extension );
+}
 
-/* Pseudo-modulo operation. divisor * quotient >= dividend for positive arguments. */
-lldiv_t lldivGreater ( long long dividend, long long divisor ) {
-	lldiv_t greater;
-	lldiv_t normal = lldiv( dividend, divisor );
-	if ( normal.rem == 0) {
-		greater.quot = normal.quot;
-		greater.rem = normal.rem;
+/* Creates the Game of a variant with the cells of the reference Grid. A file-backed Game lives in a scratch file; a mapped one is loaded from a
+ * snapshot of a contiguous Game. Either file is removed at once, as the mapping outlives it. Returns a pointer to the Game, if successful.
+ * Returns a NULL pointer otherwise. */
+static Game *createVerifyGame( const BenchmarkWorkload *workloadPtr, const VerifyVariant *variantPtr, Grid *referenceGridPtr ) {
+	Game *newGamePtr = NULL;
+	char path[GOL__VERIFY__PATH_SIZE];
+	
+	if ( variantPtr->storageMode == GOL__STORAGE__FILE ) {
+		verifyScratchPath( path, sizeof( path ), "grid" );
+		newGamePtr = createGameInFile( workloadPtr->gridSizeX, workloadPtr->gridSizeY, workloadPtr->outOfBoundsRule, path );
+		remove( path );
+	} else if ( variantPtr->storageMode == GOL__STORAGE__MAPPED ) {
+		Game *sourcePtr = createGame( workloadPtr->gridSizeX, workloadPtr->gridSizeY, workloadPtr->outOfBoundsRule );
+		if ( sourcePtr != NULL ) {
+			verifyScratchPath( path, sizeof( path ), "snapshot" );
+			copyGridCells( referenceGridPtr, sourcePtr->currentGridPtr );
+			if ( saveGameSnapshot( sourcePtr, path ) == 0 ) {
+				newGamePtr = loadGameSnapshot( path, true );
+			}
+			remove( path );
+			destroyGame( sourcePtr );
+		}
 	} else {
-		if ( ( dividend >= 0 && divisor >= 0 ) ||
-			( dividend < 0 && divisor < 0 ) ) {
-			greater.quot = normal.quot + 1;
-			greater.rem = normal.rem - divisor;
-		} else {
-			greater.quot = normal.quot - 1;
-			greater.rem = normal.rem + divisor;	
+		newGamePtr = createGameWithStorage( workloadPtr->gridSizeX, workloadPtr->gridSizeY, workloadPtr->outOfBoundsRule, variantPtr->storageMode, 0 );
+	}
+	if ( newGamePtr != NULL ) {
+		setGameEngine( newGamePtr, variantPtr->engine );
+		setGameRule( newGamePtr, workloadPtr->rule );
+		setGameThreadCount( newGamePtr, GOL__VERIFY__THREADS );
+		if ( variantPtr->storageMode != GOL__STORAGE__MAPPED ) {
+			copyGridCells( referenceGridPtr, newGamePtr->currentGridPtr );
 		}
 	}
-	return greater;
-};
+	
+	return newGamePtr;
+}
 
-/* Modulo operation with nonnegative remainder. */
-lldiv_t lldivPositive ( long long dividend, long long divisor ) {
-	lldiv_t positive;
-	lldiv_t normal = lldiv( dividend, divisor );
-	if ( normal.rem >= 0 ) {
-		positive = normal;
+/* Returns true, if the GenerationStats agree on everything but the generation. */
+static bool sameGenerationStats( const GenerationStats *statsPtr, const GenerationStats *otherPtr ) {
+	return statsPtr->population == otherPtr->population && statsPtr->changed == otherPtr->changed && statsPtr->hash == otherPtr->hash
+		&& statsPtr->minX == otherPtr->minX && statsPtr->minY == otherPtr->minY && statsPtr->maxX == otherPtr->maxX && statsPtr->maxY == otherPtr->maxY;
+}
+
+/* Runs the workload for generations generations on every variant the CPU supports, on a GameBatch and, while they apply, on HashLife and a Plane,
+ * and compares them with the reference engine after every round. Soups are seeded with the seed. Each disagreement is reported on stderr.
+ * Returns 0 if all agree; 1 if one does not; 2 on malloc failure, a failed scratch file or an invalid rule. */
+ErrorChar verifyEngines( const BenchmarkWorkload *workloadPtr, uint64_t seed, unsigned long long generations ) {
+	ErrorChar error = 0;
+	
+	const size_t variantCount = sizeof( verifyVariants ) / sizeof( verifyVariants[0] );
+	Game *gamePtrs[ sizeof( verifyVariants ) / sizeof( verifyVariants[0] ) ] = { NULL };
+	char originalKernel = activeRowKernel();
+	long long sizeX = workloadPtr->gridSizeX;
+	long long sizeY = workloadPtr->gridSizeY;
+	char description[160];
+	Game *referencePtr = createGame( sizeX, sizeY, workloadPtr->outOfBoundsRule );
+	GameBatch *batchPtr = createGameBatch( sizeX, sizeY, workloadPtr->outOfBoundsRule );
+	HashLife *universePtr = NULL;
+	Plane *planePtr = NULL;
+	Game *exportPtrs[2] = { NULL, NULL }; // receive the cells of the universe and of the Plane, and step from them once on the tiled engine
+	bool unbounded = false; // HashLife and the Plane are stepped and compared
+	
+	snprintf( description, sizeof( description ), "%lld x %lld, %s, %s, %s %.2f, seed %llu", sizeX, sizeY, verifyBoundaryNames[ (int) workloadPtr->outOfBoundsRule ],
+		workloadPtr->rule, verifyPatternNames[ (int) workloadPtr->pattern ], workloadPtr->density, (unsigned long long) seed );
+	if ( referencePtr == NULL || batchPtr == NULL ) {
+		error = 2;
+	} else if ( setGameRule( referencePtr, workloadPtr->rule ) != 0 || setGameBatchRule( batchPtr, workloadPtr->rule ) != 0 ) {
+		error = 2;
 	} else {
-		positive.quot = normal.quot - 1;
-		positive.rem = normal.rem + divisor;
+		Grid *referenceGridPtr = referencePtr->currentGridPtr;
+		setGameEngine( referencePtr, GOL__ENGINE__REFERENCE );
+		seedBenchmarkWorkload( referenceGridPtr, workloadPtr, seed );
+		randomizeGameBatch( batchPtr, seed, 0.5 ); // lanes 0 and 63 carry the workload, the others must not leak into them
+		for ( long long x = 0; x < sizeX; ++x ) {
+			for ( long long y = 0; y < sizeY; ++y ) {
+				setGameBatchCell( batchPtr, 0, x, y, getCell( referenceGridPtr, x, y ) );
+				setGameBatchCell( batchPtr, 63, x, y, getCell( referenceGridPtr, x, y ) );
+			}
+		}
+		for ( size_t variant = 0; error == 0 && variant < variantCount; ++variant ) {
+			const VerifyVariant *variantPtr = &(verifyVariants[variant]);
+#ifdef _WINDOWS
+			if ( variantPtr->storageMode == GOL__STORAGE__FILE ) {
+				continue; // needs mmap
+			}
+#endif
+			if ( rowKernelSupported( variantPtr->kernel ) == true ) {
+				gamePtrs[variant] = createVerifyGame( workloadPtr, variantPtr, referenceGridPtr );
+				if ( gamePtrs[variant] == NULL ) {
+					error = 2;
+				}
+			}
+		}
+		if ( error == 0 && workloadPtr->outOfBoundsRule == GOL__OOBR__ALL_OFF && referencePtr->rule.family == GOL__RULE__CONWAY ) {
+			universePtr = createHashLife();
+			planePtr = createPlane();
+			exportPtrs[0] = createGame( sizeX, sizeY, GOL__OOBR__ALL_OFF );
+			exportPtrs[1] = createGame( sizeX, sizeY, GOL__OOBR__ALL_OFF );
+			if ( universePtr == NULL || planePtr == NULL || exportPtrs[0] == NULL || exportPtrs[1] == NULL ||
+					importGameIntoHashLife( universePtr, referencePtr ) != 0 || importGameIntoPlane( planePtr, referencePtr ) != 0 ) {
+				error = 2;
+			} else {
+				exportHashLifeToGame( universePtr, exportPtrs[0] );
+				exportPlaneToGame( planePtr, exportPtrs[1], 0, 0 );
+				for ( int source = 0; source < 2; ++source ) {
+					setGameEngine( exportPtrs[source], GOL__ENGINE__TILED );
+					iterateGame( exportPtrs[source] );
+				}
+				unbounded = true;
+			}
+		}
 	}
-	return positive;
+	for ( unsigned long long done = 0, round = 0; error == 0 && done < generations; ++round ) {
+		unsigned long long steps = 1 + round * 5 % ( GOL__TEMPORAL__GENERATIONS + 3 );
+		steps = ( steps < generations - done ) ? steps : generations - done;
+		for ( unsigned long long step = 0; step < steps; ++step ) {
+			unbounded = unbounded && gridEdgeIsEmpty( referencePtr->currentGridPtr ); // from here on, the plane may rightly grow past the Grid
+			iterateGame( referencePtr );
+			iterateGameBatch( batchPtr );
+			for ( int source = 0; unbounded == true && step == 0 && error == 0 && source < 2; ++source ) {
+				error = compareExportedGame( exportPtrs[source], referencePtr, verifyExportNames[ 2 + source ], done + 1, description );
+				randomizeGameWithSeed( exportPtrs[source], 0, 0.0 ); // all off, and every tile stable after the next step
+				iterateGame( exportPtrs[source] );
+				if ( error == 0 && getGameStats( exportPtrs[source] ) == NULL ) { // cached, so that the export must invalidate them
+					error = 2;
+				}
+			}
+		}
+		if ( unbounded == true && error == 0 ) {
+			error = ( stepHashLife( universePtr, steps ) != 0 ) ? 2 : 0;
+			for ( unsigned long long step = 0; error == 0 && step < steps; ++step ) {
+				error = ( iteratePlane( planePtr ) != 0 ) ? 2 : 0;
+			}
+		}
+		for ( size_t variant = 0; variant < variantCount; ++variant ) {
+			if ( gamePtrs[variant] != NULL ) {
+				selectRowKernel( ( verifyVariants[variant].kernel == GOL__KERNEL__AUTO ) ? originalKernel : verifyVariants[variant].kernel );
+				if ( verifyVariants[variant].blocked == true ) {
+					iterateGameN( gamePtrs[variant], steps );
+				} else {
+					for ( unsigned long long step = 0; step < steps; ++step ) {
+						iterateGame( gamePtrs[variant] );
+					}
+				}
+			}
+		}
+		selectRowKernel( originalKernel );
+		done += steps;
+		
+		const GenerationStats *referenceStatsPtr = getGameStats( referencePtr );
+		long long x;
+		long long y;
+		for ( size_t variant = 0; variant < variantCount; ++variant ) {
+			Game *gamePtr = gamePtrs[variant];
+			if ( gamePtr == NULL ) {
+				continue;
+			}
+			if ( findDifferentCell( referencePtr->currentGridPtr, gamePtr->currentGridPtr, &x, &y ) == true ) {
+				fprintf( stderr, "ERROR: %s differs from the reference in cell ( %lld, %lld ) after generation %llu of %s.\n", verifyVariants[variant].name,
+					x, y, done, description );
+				error = 1;
+			} else if ( gamePtr->stats.generation == gamePtr->generation && referenceStatsPtr != NULL
+					&& sameGenerationStats( &(gamePtr->stats), referenceStatsPtr ) == false ) {
+				fprintf( stderr, "ERROR: The statistics of %s differ from the reference after generation %llu of %s.\n", verifyVariants[variant].name,
+					done, description );
+				error = 1;
+			}
+		}
+		for ( int source = 0; unbounded == true && error == 0 && source < 2; ++source ) {
+			unsigned long long population;
+			if ( source == 0 ) {
+				exportHashLifeToGame( universePtr, exportPtrs[0] );
+				population = hashLifePopulation( universePtr );
+			} else {
+				exportPlaneToGame( planePtr, exportPtrs[1], 0, 0 );
+				population = planePopulation( planePtr );
+			}
+			error = compareExportedGame( exportPtrs[source], referencePtr, verifyExportNames[source], done, description );
+			if ( error == 0 && population != getGameStats( referencePtr )->population ) {
+				fprintf( stderr, "ERROR: %s has %llu live cells, the reference %llu, after generation %llu of %s.\n", verifyExportNames[source], population,
+					(unsigned long long) getGameStats( referencePtr )->population, done, description );
+				error = 1;
+			}
+			iterateGame( exportPtrs[source] ); // compared with the reference after its next generation
+		}
+		for ( int lane = 0; lane < 64; lane += 63 ) {
+			bool found = false;
+			for ( x = 0; found == false && x < sizeX; ++x ) {
+				for ( y = 0; found == false && y < sizeY; ++y ) {
+					found = getGameBatchCell( batchPtr, lane, x, y ) != getCell( referencePtr->currentGridPtr, x, y );
+				}
+			}
+			if ( found == true ) {
+				fprintf( stderr, "ERROR: Lane %d of the batch differs from the reference in cell ( %lld, %lld ) after generation %llu of %s.\n", lane,
+					x - 1, y - 1, done, description );
+				error = 1;
+			}
+		}
+	}
+	if ( error == 2 ) {
+		fprintf( stderr, "ERROR: Could not set up the verification of %s.\n", description );
+	}
+	for ( size_t variant = 0; variant < variantCount; ++variant ) {
+		if ( gamePtrs[variant] != NULL ) {
+			destroyGame( gamePtrs[variant] );
+		}
+	}
+	if ( batchPtr != NULL ) {
+		destroyGameBatch( batchPtr );
+	}
+	if ( universePtr != NULL ) {
+		destroyHashLife( universePtr );
+	}
+	if ( planePtr != NULL ) {
+		destroyPlane( planePtr );
+	}
+	for ( int source = 0; source < 2; ++source ) {
+		if ( exportPtrs[source] != NULL ) {
+			destroyGame( exportPtrs[source] );
+		}
+	}
+	if ( referencePtr != NULL ) {
+		destroyGame( referencePtr );
+	}
+	
+	return error;
+}
+
+/* Verifies every engine on Grids of awkward sizes: single cells, single rows and columns, widths around the word size. Each size runs with every
+ * outOfBoundsRule, several rules, patterns that load the edges and an R-pentomino in the middle, which HashLife and the Plane can follow for a
+ * while, for generations generations each. Prints a summary to stdout.
+ * Returns 0 if every engine agrees with the reference everywhere; > 0 otherwise. */
+ErrorChar runVerification( unsigned long long generations, uint64_t seed ) {
+	ErrorChar error = 0;
+	
+	const long long sizes[][2] = { { 1, 1 }, { 1, 7 }, { 7, 1 }, { 2, 2 }, { 3, 3 }, { 1, 64 }, { 1, 65 }, { 64, 1 }, { 5, 63 }, { 9, 64 }, { 10, 65 },
+		{ 13, 127 }, { 17, 128 }, { 33, 129 }, { 70, 200 }, { 130, 66 } };
+	const char *rules[] = { "B3/S23", "B36/S23", "B3678/S34678", "B1357/S1357", "B0123478/S01234678" };
+	const char patterns[] = { GOL__PATTERN__SOUP, GOL__PATTERN__SOUP, GOL__PATTERN__FULL, GOL__PATTERN__BORDER, GOL__PATTERN__CHECKERBOARD,
+		GOL__PATTERN__CORNER_GLIDERS, GOL__PATTERN__R_PENTOMINO };
+	const double densities[] = { 0.15, 0.5, 0.0, 0.0, 0.0, 0.0, 0.0 };
+	unsigned long long caseCount = 0;
+	unsigned long long failureCount = 0;
+	double start = monotonicSeconds();
+	
+	for ( size_t size = 0; error < 2 && size < sizeof( sizes ) / sizeof( sizes[0] ); ++size ) {
+		for ( char outOfBoundsRule = GOL__OOBR__ALL_OFF; error < 2 && outOfBoundsRule <= GOL__OOBR__TORUS; ++outOfBoundsRule ) {
+			for ( size_t rule = 0; error < 2 && rule < sizeof( rules ) / sizeof( rules[0] ); ++rule ) {
+				for ( size_t pattern = 0; error < 2 && pattern < sizeof( patterns ); ++pattern ) {
+					BenchmarkWorkload workload = { "verify", sizes[size][0], sizes[size][1], outOfBoundsRule, patterns[pattern], densities[pattern], rules[rule] };
+					ErrorChar caseError = verifyEngines( &workload, seed + caseCount, generations );
+					error = ( caseError > error ) ? caseError : error;
+					failureCount += ( caseError != 0 );
+					++caseCount;
+				}
+			}
+		}
+	}
+	printf( "Verified %llu cases of %llu generations in %.1f s: %llu failed.\n", caseCount, generations, monotonicSeconds() - start, failureCount );
+	
+	return error;
+}
+
+#if defined( GOL__FUZZ ) && defined( GOL__FUZZ_RLE )
+/* Entry point for libFuzzer ( clang -fsanitize=fuzzer,address -DGOL__FUZZ -DGOL__FUZZ_RLE gameOfLife.c ): the input is read as an RLE pattern
+ * into a fixed Grid. A pattern that is accepted must come back unchanged through writeGameRle and readGameRle; aborts otherwise. */
+int LLVMFuzzerTestOneInput( const uint8_t *data, size_t size ) {
+	Game *gamePtr = createGame( GOL__FUZZ__RLE_SIZE_X, GOL__FUZZ__RLE_SIZE_Y, GOL__OOBR__ALL_OFF );
+	FILE *stream = tmpfile();
+	FILE *copyStream = tmpfile();
+	
+	if ( gamePtr != NULL && stream != NULL && copyStream != NULL && fwrite( data, 1, size, stream ) == size ) {
+		rewind( stream );
+		if ( readRlePattern( stream, gamePtr, 0, 0 ) == 0 && writeGameRle( copyStream, gamePtr ) == 0 ) {
+			long long x;
+			long long y;
+			rewind( copyStream );
+			Game *copyPtr = readGameRle( copyStream, GOL__OOBR__ALL_OFF );
+			if ( copyPtr == NULL || findDifferentCell( gamePtr->currentGridPtr, copyPtr->currentGridPtr, &x, &y ) == true ) {
+				abort();
+			}
+			destroyGame( copyPtr );
+		}
+	}
+	if ( stream != NULL ) {
+		fclose( stream );
+	}
+	if ( copyStream != NULL ) {
+		fclose( copyStream );
+	}
+	if ( gamePtr != NULL ) {
+		destroyGame( gamePtr );
+	}
+	
+	return 0;
+}
+#elif defined( GOL__FUZZ )
+/* Entry point for libFuzzer ( clang -fsanitize=fuzzer,address -DGOL__FUZZ gameOfLife.c ): the first bytes pick the size of the Grid, the
+ * outOfBoundsRule, the pattern and its density, any life-like rule and the generations, the rest seeds the soup. Aborts when an engine
+ * disagrees with the reference, so that the fuzzer keeps the input. */
+int LLVMFuzzerTestOneInput( const uint8_t *data, size_t size ) {
+	if ( size >= 8 ) {
+		Rule rule;
+		char notation[GOL__RULE__NOTATION_SIZE];
+		uint64_t seed = 0;
+		const char patterns[] = { GOL__PATTERN__SOUP, GOL__PATTERN__FULL, GOL__PATTERN__BORDER, GOL__PATTERN__CHECKERBOARD, GOL__PATTERN__CORNER_GLIDERS,
+			GOL__PATTERN__R_PENTOMINO };
+		
+		rule.birth = (uint16_t) ( data[5] | ( data[7] & 1 ) << 8 );
+		rule.survival = (uint16_t) ( data[6] | ( data[7] & 2 ) << 7 );
+		formatRule( &rule, notation );
+		for ( size_t i = 8; i < size; ++i ) {
+			seed = ( seed ^ data[i] ) * 0x100000001B3ULL;
+		}
+		BenchmarkWorkload workload = { "fuzz", 1 + data[0] % 96, 1 + data[1] % 160, (char) ( data[2] % 3 ), patterns[ data[3] % sizeof( patterns ) ],
+			data[4] / 255.0, notation };
+		if ( verifyEngines( &workload, seed, 1 + ( data[7] >> 2 ) % 32 ) == 1 ) {
+			abort();
+		}
+	}
+	
+	return 0;
 }
+#endif
 
 
 /* Demos */
@@ -569,58 +6561,115 @@ void gliderGunDemo() {
 	
 	Game *gliderGunGame = createGame( myGridSizeX, myGridSizeY, myOutOfBoundsRule );
 
+	placeGliderGun( gliderGunGame->currentGridPtr );
+	
+	PrintOptions demoOptions = {'.', 'O'};
+	unsigned int sleepInMilliseconds = 100;
+
+	printAndIterateGameLoop( gliderGunGame, &demoOptions, sleepInMilliseconds );
+}
+
+/* An endless loop to showcase a Game of Life glider gun on the unbounded Plane. Prints a 20 x 60 window to stdout; the gliders leave it, but live on. */
+void unboundedGliderGunDemo() {
+	Game *windowGame = createGame( 20, 60, GOL__OOBR__ALL_OFF );
+	Plane *plane = createPlane();
+	
+	placeGliderGun( windowGame->currentGridPtr );
+	importGameIntoPlane( plane, windowGame );
+	
+	PrintOptions demoOptions = {'.', 'O'};
+	unsigned int sleepInMilliseconds = 100;
+	bool running = true;
+	char title[GOL__RENDER__TITLE_SIZE];
+	
+	Renderer *rendererPtr = createRenderer( 20, 60, &demoOptions, true );
+	
+	fflush( stdout );
+	while ( running == true && rendererPtr != NULL ) {
+		exportPlaneToGame( plane, windowGame, 0, 0 );
+		snprintf( title, sizeof( title ), "GAME OF LIFE - generation %llu, population %llu, %zu chunks", plane->generation, planePopulation( plane ), plane->chunkCount );
+		running = renderGrid( rendererPtr, windowGame->currentGridPtr, title ) == 0;
+		iteratePlane( plane );
+		
+		Sleep( sleepInMilliseconds );
+	}
+}
+
+/* An endless loop to showcase a random 1024 x 2048 torus on the parallel engine, fitted into 40 x 100 braille glyphs. Prints to stdout. */
+void largeGameDemo() {
+	Game *largeGame = createGame( 1024, 2048, GOL__OOBR__TORUS );
+	Viewport *viewport = createViewport( 40, 100, GOL__GLYPHS__BRAILLE );
+	
+	randomizeGame( largeGame );
+	setGameEngine( largeGame, GOL__ENGINE__PARALLEL );
+	fitViewport( viewport, largeGame->currentGridPtr );
+	
+	unsigned int sleepInMilliseconds = 50;
+	bool running = true;
+	char title[GOL__RENDER__TITLE_SIZE];
+	unsigned long long generation = 0;
+	
+	fflush( stdout );
+	printf( "\x1b[2J" );
+	while ( running == true ) {
+		snprintf( title, sizeof( title ), "GAME OF LIFE - generation %llu, %lld cells per dot", generation, viewport->zoom * viewport->zoom );
+		running = renderViewport( viewport, largeGame->currentGridPtr, title ) == 0;
+		iterateGame( largeGame );
+		++generation;
+		
+		Sleep( sleepInMilliseconds );
+	}
+}
+
+/* Sets the cells of a Gosper glider gun in the top left corner of the Grid, which must be at least 10 x 37. */
+void placeGliderGun( Grid *gridPtr ) {
 	/* Setting the glider gun point by point */
 	/* X == 1 */
-	setCell( gliderGunGame->currentGridPtr, 1, 25, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 1, 25, GOL__CELL_STATE__ON );
 	/* X == 2 */
-	setCell( gliderGunGame->currentGridPtr, 2, 23, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 2, 25, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 2, 23, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 2, 25, GOL__CELL_STATE__ON );
 	/* X == 3 */
-	setCell( gliderGunGame->currentGridPtr, 3, 13, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 3, 14, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 3, 21, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 3, 22, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 3, 35, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 3, 36, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 3, 13, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 3, 14, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 3, 21, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 3, 22, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 3, 35, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 3, 36, GOL__CELL_STATE__ON );
 	/* X == 4 */
-	setCell( gliderGunGame->currentGridPtr, 4, 12, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 4, 16, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 4, 21, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 4, 22, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 4, 35, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 4, 36, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 4, 12, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 4, 16, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 4, 21, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 4, 22, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 4, 35, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 4, 36, GOL__CELL_STATE__ON );
 	/* X == 5 */
-	setCell( gliderGunGame->currentGridPtr, 5,  1, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 5,  2, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 5, 11, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 5, 17, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 5, 21, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 5, 22, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 5,  1, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 5,  2, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 5, 11, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 5, 17, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 5, 21, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 5, 22, GOL__CELL_STATE__ON );
 	/* X == 6 */
-	setCell( gliderGunGame->currentGridPtr, 6,  1, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 6,  2, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 6, 11, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 6, 15, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 6, 17, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 6, 18, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 6, 23, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 6, 25, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 6,  1, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 6,  2, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 6, 11, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 6, 15, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 6, 17, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 6, 18, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 6, 23, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 6, 25, GOL__CELL_STATE__ON );
 	/* X == 7 */
-	setCell( gliderGunGame->currentGridPtr, 7, 11, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 7, 11, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 7, 17, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 7, 25, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 7, 11, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 7, 11, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 7, 17, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 7, 25, GOL__CELL_STATE__ON );
 	/* X == 8 */
-	setCell( gliderGunGame->currentGridPtr, 8, 12, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 8, 16, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 8, 12, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 8, 16, GOL__CELL_STATE__ON );
 	/* X == 9 */
-	setCell( gliderGunGame->currentGridPtr, 9, 13, GOL__CELL_STATE__ON );
-	setCell( gliderGunGame->currentGridPtr, 9, 14, GOL__CELL_STATE__ON );
-	
-	PrintOptions demoOptions = {'.', 'O'};
-	unsigned int sleepInMilliseconds = 100;
-
-	printAndIterateGameLoop( gliderGunGame, &demoOptions, sleepInMilliseconds );
+	setCell( gridPtr, 9, 13, GOL__CELL_STATE__ON );
+	setCell( gridPtr, 9, 14, GOL__CELL_STATE__ON );
 }
 
 
@@ -634,4 +6683,86 @@ void clearCmd() {
 #ifdef WINDOWS
 	system( "cls" );
 #endif
+}
+
+/* Allocates size zeroed bytes starting at a multiple of alignment (a power of two). Free with alignedFree. Returns NULL on failure.
+ * Built on calloc rather than aligned_alloc, so that large blocks still get lazily zeroed pages and it works with every C11 runtime. */
+void *alignedCalloc( size_t size, size_t alignment ) {
+	void *aligned = NULL;
+	
+	if ( size <= SIZE_MAX - alignment - sizeof( void * ) ) {
+		char *raw = (char *) calloc( size + alignment + sizeof( void * ), 1 );
+		if ( raw != NULL ) {
+			uintptr_t first = (uintptr_t) ( raw + sizeof( void * ) );
+			aligned = (void *) ( ( first + alignment - 1 ) & ~( (uintptr_t) alignment - 1 ) );
+			memcpy( (char *) aligned - sizeof( void * ), &raw, sizeof( void * ) ); // remember the raw pointer for alignedFree
+		}
+	}
+	
+	return aligned;
+}
+
+/* Frees memory allocated by alignedCalloc. Does nothing for NULL. */
+void alignedFree( void *ptr ) {
+	if ( ptr != NULL ) {
+		void *raw;
+		memcpy( &raw, (char *) ptr - sizeof( void * ), sizeof( void * ) );
+		free( raw );
+	}
+}
+
+/* Writes all bytes to stdout at once, bypassing the stdio buffer on POSIX. Returns 0 on success; > 0 on error. */
+ErrorChar writeStandardOutput( const char *bytes, size_t length ) {
+	ErrorChar error = 0;
+	
+	fflush( stdout ); // whatever went through stdio comes first
+#ifdef _WINDOWS
+	if ( fwrite( bytes, 1, length, stdout ) != length || fflush( stdout ) != 0 ) {
+		error = 1;
+	}
+#else
+	while ( error == 0 && length > 0 ) {
+		ssize_t written = write( STDOUT_FILENO, bytes, length );
+		if ( written > 0 ) {
+			bytes += written;
+			length -= (size_t) written;
+		} else if ( written < 0 && errno != EINTR ) {
+			error = 1;
+		}
+	}
+#endif
+	
+	return error;
+}
+
+/* Returns a monotonic time in seconds, for benchmarks. Only differences are meaningful. */
+double monotonicSeconds() {
+#ifdef _WINDOWS
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+	QueryPerformanceCounter( &counter );
+	QueryPerformanceFrequency( &frequency );
+	return (double) counter.QuadPart / (double) frequency.QuadPart;
+#else
+	struct timespec now;
+	clock_gettime( CLOCK_MONOTONIC, &now );
+	return (double) now.tv_sec + (double) now.tv_nsec * 1e-9;
+#endif
+}
+
+/* Returns the peak resident set size of the process in KiB, or 0 where it is not available. */
+long peakResidentKilobytes() {
+#ifdef _WINDOWS
+	return 0;
+#else
+	struct rusage usage;
+	long peak = 0;
+	if ( getrusage( RUSAGE_SELF, &usage ) == 0 ) {
+		peak = usage.ru_maxrss;
+#ifdef __APPLE__
+		peak /= 1024; // bytes there
+#endif
+	}
+	return peak;
+#endif
 }
\ No newline at end of file